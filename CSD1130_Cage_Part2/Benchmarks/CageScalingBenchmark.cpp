@@ -0,0 +1,421 @@
+/******************************************************************************/
+/*!
+\file		CageScalingBenchmark.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Frame level benchmark of the Cage update: how the time of a
+			whole frame grows with the number of balls, walls and worker
+			threads. For every ball count and loose wall count a level is
+			generated (LevelRandom.h, the same for every run of the same
+			seed), then for every thread count it is stepped like
+			GameStateCageUpdate does: CageSimAdvance of one fixed step
+			(integration, broadphase and collision) followed by the ball
+			transforms, interpolated and composed like
+			gameObjInstTransformUpdate.
+
+			Reported per run: ns per ball per frame, throughput in millions
+			of balls per second, the speedup over the first thread count,
+			and the checksum of the final ball state, which must not depend
+			on the thread count. -csv saves one row per run for plotting;
+			-baseline compares the ns per ball per frame to a CSV saved
+			earlier and fails when a run is slower by more than -tolerance,
+			so that it can gate changes on large levels.
+
+			Usage:
+			CageScalingBenchmark [-balls N,N,...] [-walls N,N,...]
+								 [-threads N,N,...] [-frames N] [-warmup N]
+								 [-cages N] [-seed N] [-broadphase 0|1]
+								 [-collision 0|1|2] [-edges 0|1]
+								 [-ballcollision 0|1] [-csv file.csv]
+								 [-baseline file.csv] [-tolerance fraction]
+
+			-balls		ball counts (default 1000,10000,100000)
+			-walls		loose wall counts, the cages add theirs
+						(default 100,1000)
+			-threads	worker counts, 0 for one per hardware thread
+						(default 1,2,4)
+			-frames		timed frames of each run (default 60)
+			-warmup		frames run before timing (default 10)
+			-cages		nested cages of the levels (default 4)
+			-seed		seed of the levels (default 1130)
+			-broadphase, -collision, -edges, -ballcollision
+						as in the game (default 1, 1, 1, 1)
+			-csv		write the results to a CSV file
+			-baseline	CSV file to compare the results to
+			-tolerance	allowed slowdown over the baseline (default 0.1)
+
+			Build through the CageScalingBenchmark target of
+			CMakeLists.txt.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "Affine2D.h"
+#include "CageSimulation.h"
+#include "LevelBinary.h"
+#include "LevelRandom.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	const float			STEP_DT			= 1.0f / 60.0f;
+
+	typedef std::chrono::steady_clock	Clock;
+
+	struct BenchSettings
+	{
+		std::vector<unsigned int>	m_ballNums{ 1000, 10000, 100000 };
+		std::vector<unsigned int>	m_wallNums{ 100, 1000 };
+		std::vector<unsigned int>	m_threadNums{ 1, 2, 4 };
+		int							m_frameNum		= 60;
+		int							m_warmupNum		= 10;
+		unsigned int				m_cageNum		= 4;
+		unsigned int				m_seed			= 1130;
+		int							m_broadphase	= 1;
+		int							m_collision		= 1;
+		bool						m_checkLineEdges	= true;
+		bool						m_ballCollision	= true;
+		double						m_tolerance		= 0.1;
+	};
+
+	struct RunResult
+	{
+		unsigned int		m_ballNum{};
+		unsigned int		m_wallNum{};				// cage and loose walls
+		unsigned int		m_threadNum{};				// workers actually used
+		double				m_stepMs{};					// per frame
+		double				m_transformMs{};			// per frame
+		double				m_nsPerBall{};				// per frame, step and transforms
+		double				m_ballsPerSecond{};			// millions
+		double				m_speedup{};				// over the first thread count
+		double				m_wallTests{};				// per frame
+		unsigned long long	m_checksum{};
+	};
+
+	typedef std::tuple<unsigned int, unsigned int, unsigned int>	RunKey;	// balls, walls, threads
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// FNV-1a over the bits of the values, as CageHeadless does
+	unsigned long long HashFloats(unsigned long long hash, const float *pValues, unsigned int num)
+	{
+		for (unsigned int i = 0; i < num; ++i) {
+			unsigned int bits;
+			memcpy(&bits, pValues + i, sizeof(bits));
+			for (int b = 0; b < 4; ++b) {
+				hash ^= (bits >> (b * 8)) & 0xFFu;
+				hash *= 1099511628211ull;
+			}
+		}
+		return hash;
+	}
+
+	// "1,2,4" into its numbers, false if one is not a number
+	bool ParseList(const char *pText, std::vector<unsigned int> &values)
+	{
+		values.clear();
+		std::stringstream stream(pText);
+		std::string item;
+		while (std::getline(stream, item, ',')) {
+			char *pEnd = NULL;
+			unsigned long value = strtoul(item.c_str(), &pEnd, 10);
+			if (item.empty() || *pEnd != '\0')
+				return false;
+			values.push_back((unsigned int)value);
+		}
+		return !values.empty();
+	}
+
+	/**************************************************************************/
+	/*!
+		Steps the level for the warm up and timed frames on threadNum
+		workers, and measures the timed ones
+	 */
+	/**************************************************************************/
+	void RunLevel(const BenchSettings &settings, const LevelBinary &level, unsigned int threadNum, RunResult &result)
+	{
+		CageSimulation sim;
+		CageSimInit(sim, level, settings.m_broadphase, settings.m_collision, settings.m_checkLineEdges, settings.m_ballCollision);
+
+		JobSystem jobs;
+		JobSystemInit(jobs, threadNum);
+
+		std::vector<CSD1130::Aff2D> transforms(sim.m_balls.m_count);
+		double stepMs = 0.0, transformMs = 0.0;
+		unsigned long long wallTestStart = 0;
+
+		for (int frame = 0; frame < settings.m_warmupNum + settings.m_frameNum; ++frame) {
+			if (frame == settings.m_warmupNum) {
+				stepMs = transformMs = 0.0;
+				wallTestStart = CageSimWallTestNum(sim);
+			}
+
+			Clock::time_point start = Clock::now();
+			CageSimAdvance(sim, STEP_DT, STEP_DT, 1, &jobs);
+			stepMs += ElapsedMs(start);
+
+			// the transforms of GameStateCageUpdate, between the last two steps
+			start = Clock::now();
+			const BallStore &balls	= sim.m_balls;
+			const float alpha		= (float)(sim.m_frameTimeLeft / STEP_DT);
+			for (unsigned int i = 0; i < balls.m_count; ++i) {
+				float posX = balls.m_prevPosX[i] + (balls.m_posX[i] - balls.m_prevPosX[i]) * alpha;
+				float posY = balls.m_prevPosY[i] + (balls.m_posY[i] - balls.m_prevPosY[i]) * alpha;
+				CSD1130::Aff2DCompose(transforms[i], posX, posY, balls.m_radius[i], balls.m_radius[i], 0.0f);
+			}
+			transformMs += ElapsedMs(start);
+		}
+
+		const BallStore &balls = sim.m_balls;
+		unsigned long long hash = 14695981039346656037ull;
+		hash = HashFloats(hash, balls.m_posX.data(), balls.m_count);
+		hash = HashFloats(hash, balls.m_posY.data(), balls.m_count);
+		hash = HashFloats(hash, balls.m_velX.data(), balls.m_count);
+		hash = HashFloats(hash, balls.m_velY.data(), balls.m_count);
+
+		// the transforms are otherwise never read
+		for (const CSD1130::Aff2D &transform : transforms)
+			hash ^= transform.m02 == transform.m02 ? 0 : 1;
+
+		double frameNum = settings.m_frameNum > 0 ? settings.m_frameNum : 1;
+		result.m_wallNum		= sim.m_wallNum;
+		result.m_threadNum		= JobSystemWorkerNum(jobs);
+		result.m_stepMs			= stepMs / frameNum;
+		result.m_transformMs	= transformMs / frameNum;
+		result.m_nsPerBall		= balls.m_count ? (stepMs + transformMs) * 1.0e6 / (frameNum * balls.m_count) : 0.0;
+		result.m_ballsPerSecond	= result.m_nsPerBall > 0.0 ? 1.0e3 / result.m_nsPerBall : 0.0;
+		result.m_wallTests		= (double)(CageSimWallTestNum(sim) - wallTestStart) / frameNum;
+		result.m_checksum		= hash;
+
+		CageSimClear(sim);
+		JobSystemShutdown(jobs);
+	}
+
+	// Prints one value of each run, the ball and wall counts down, the
+	// thread counts across
+	void PrintTable(const char *pTitle, const std::vector<RunResult> &results, size_t threadCountNum,
+		double RunResult::*pValue)
+	{
+		printf("\n%s\n%10s %8s", pTitle, "balls", "walls");
+		for (size_t t = 0; t < threadCountNum; ++t)
+			printf("  %9s%-2u", "threads ", results[t].m_threadNum);
+		printf("\n");
+
+		for (size_t i = 0; i < results.size(); i += threadCountNum) {
+			printf("%10u %8u", results[i].m_ballNum, results[i].m_wallNum);
+			for (size_t t = 0; t < threadCountNum; ++t)
+				printf("  %11.3f", results[i + t].*pValue);
+			printf("\n");
+		}
+	}
+
+	bool WriteCsv(const char *pFileName, const std::vector<RunResult> &results)
+	{
+		std::ofstream outFile(pFileName);
+		if (!outFile.is_open())
+			return false;
+
+		outFile << "balls,walls,threads,step_ms,transform_ms,ns_per_ball_frame,mballs_per_second,speedup,wall_tests_per_frame,checksum\n";
+		outFile << std::fixed;
+		for (const RunResult &result : results) {
+			outFile << result.m_ballNum << ',' << result.m_wallNum << ',' << result.m_threadNum << ','
+				<< std::setprecision(4) << result.m_stepMs << ',' << result.m_transformMs << ','
+				<< result.m_nsPerBall << ',' << result.m_ballsPerSecond << ',' << result.m_speedup << ','
+				<< std::setprecision(1) << result.m_wallTests << ','
+				<< std::hex << std::setw(16) << std::setfill('0') << result.m_checksum << std::dec << '\n';
+		}
+
+		outFile.close();
+		return !outFile.fail();
+	}
+
+	// ns per ball per frame of each run of a CSV written by WriteCsv
+	bool ReadBaseline(const char *pFileName, std::map<RunKey, double> &baseline)
+	{
+		std::ifstream inFile(pFileName);
+		if (!inFile.is_open())
+			return false;
+
+		std::string line;
+		std::getline(inFile, line);
+		while (std::getline(inFile, line)) {
+			unsigned int ballNum, wallNum, threadNum;
+			double stepMs, transformMs, nsPerBall;
+			char comma;
+			std::stringstream stream(line);
+			if (stream >> ballNum >> comma >> wallNum >> comma >> threadNum >> comma
+					>> stepMs >> comma >> transformMs >> comma >> nsPerBall)
+				baseline[RunKey(ballNum, wallNum, threadNum)] = nsPerBall;
+		}
+		return true;
+	}
+
+	void PrintUsage()
+	{
+		printf("usage: CageScalingBenchmark [-balls N,N,...] [-walls N,N,...]\n"
+			"                            [-threads N,N,...] [-frames N] [-warmup N]\n"
+			"                            [-cages N] [-seed N] [-broadphase 0|1]\n"
+			"                            [-collision 0|1|2] [-edges 0|1]\n"
+			"                            [-ballcollision 0|1] [-csv file.csv]\n"
+			"                            [-baseline file.csv] [-tolerance fraction]\n");
+	}
+}
+
+/******************************************************************************/
+/*!
+	Runs every level on every thread count, prints the tables, writes the
+	CSV file and compares to the baseline. Returns 1 when the checksums
+	depend on the thread count or a run is slower than the baseline allows
+*/
+/******************************************************************************/
+int main(int argc, char *argv[])
+{
+	BenchSettings settings;
+	const char *pCsvName = NULL;
+	const char *pBaselineName = NULL;
+
+	for (int i = 1; i < argc; ++i) {
+		bool ok = true;
+		if (strcmp(argv[i], "-balls") == 0 && i + 1 < argc)
+			ok = ParseList(argv[++i], settings.m_ballNums);
+		else if (strcmp(argv[i], "-walls") == 0 && i + 1 < argc)
+			ok = ParseList(argv[++i], settings.m_wallNums);
+		else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc)
+			ok = ParseList(argv[++i], settings.m_threadNums);
+		else if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc)
+			settings.m_frameNum = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-warmup") == 0 && i + 1 < argc)
+			settings.m_warmupNum = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-cages") == 0 && i + 1 < argc)
+			settings.m_cageNum = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc)
+			settings.m_seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-broadphase") == 0 && i + 1 < argc)
+			settings.m_broadphase = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-collision") == 0 && i + 1 < argc)
+			settings.m_collision = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-edges") == 0 && i + 1 < argc)
+			settings.m_checkLineEdges = atoi(argv[++i]) != 0;
+		else if (strcmp(argv[i], "-ballcollision") == 0 && i + 1 < argc)
+			settings.m_ballCollision = atoi(argv[++i]) != 0;
+		else if (strcmp(argv[i], "-csv") == 0 && i + 1 < argc)
+			pCsvName = argv[++i];
+		else if (strcmp(argv[i], "-baseline") == 0 && i + 1 < argc)
+			pBaselineName = argv[++i];
+		else if (strcmp(argv[i], "-tolerance") == 0 && i + 1 < argc)
+			settings.m_tolerance = atof(argv[++i]);
+		else
+			ok = false;
+
+		if (!ok) {
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (settings.m_broadphase > 1 || settings.m_broadphase < 0)
+		settings.m_broadphase = 0;
+	if (settings.m_collision > 2 || settings.m_collision < 0)
+		settings.m_collision = 0;
+	if (settings.m_frameNum < 1)
+		settings.m_frameNum = 1;
+	if (settings.m_warmupNum < 0)
+		settings.m_warmupNum = 0;
+
+	const char *collisionNames[] = { "in order", "continuous", "event driven" };
+	printf("broadphase %s  collision %s  edges %d  ball-ball %d  frames %d (+%d warm up)  seed %u  cages %u\n",
+		settings.m_broadphase == 0 ? "grid" : "bvh", collisionNames[settings.m_collision],
+		settings.m_checkLineEdges ? 1 : 0, settings.m_ballCollision ? 1 : 0,
+		settings.m_frameNum, settings.m_warmupNum, settings.m_seed, settings.m_cageNum);
+
+	std::vector<RunResult> results;
+	bool checksumsMatch = true;
+
+	for (unsigned int ballNum : settings.m_ballNums) {
+		for (unsigned int wallNum : settings.m_wallNums) {
+			LevelRandomSettings levelSettings;
+			levelSettings.m_seed	= settings.m_seed;
+			levelSettings.m_ballNum	= ballNum;
+			levelSettings.m_cageNum	= settings.m_cageNum;
+			levelSettings.m_wallNum	= wallNum;
+
+			LevelData levelData;
+			LevelBinary level;
+			if (!LevelRandomGenerate(levelData, levelSettings) || !LevelBinaryBuild(level, levelData)) {
+				printf("Could not generate a level of %u balls and %u walls\n", ballNum, wallNum);
+				return 1;
+			}
+
+			for (size_t t = 0; t < settings.m_threadNums.size(); ++t) {
+				RunResult result;
+				result.m_ballNum = ballNum;
+				RunLevel(settings, level, settings.m_threadNums[t], result);
+
+				const RunResult *pFirst = t > 0 ? &results[results.size() - t] : &result;
+				result.m_speedup = result.m_nsPerBall > 0.0 ? pFirst->m_nsPerBall / result.m_nsPerBall : 0.0;
+				checksumsMatch = checksumsMatch && result.m_checksum == pFirst->m_checksum;
+
+				printf("balls %8u  walls %6u  threads %2u  step %9.3f ms  transform %7.3f ms  %8.2f ns/ball/frame  checksum %016llx\n",
+					result.m_ballNum, result.m_wallNum, result.m_threadNum, result.m_stepMs, result.m_transformMs,
+					result.m_nsPerBall, result.m_checksum);
+				results.push_back(result);
+			}
+
+			LevelBinaryClose(level);
+		}
+	}
+
+	size_t threadCountNum = settings.m_threadNums.size();
+	PrintTable("ns per ball per frame", results, threadCountNum, &RunResult::m_nsPerBall);
+	PrintTable("throughput, millions of balls per second", results, threadCountNum, &RunResult::m_ballsPerSecond);
+	PrintTable("speedup", results, threadCountNum, &RunResult::m_speedup);
+
+	if (pCsvName && !WriteCsv(pCsvName, results))
+		printf("Failed to write %s\n", pCsvName);
+
+	bool ok = checksumsMatch;
+	if (!checksumsMatch)
+		printf("\nchecksums differ between thread counts\n");
+
+	if (pBaselineName) {
+		std::map<RunKey, double> baseline;
+		if (!ReadBaseline(pBaselineName, baseline)) {
+			printf("Failed to read %s\n", pBaselineName);
+			return 1;
+		}
+
+		printf("\nagainst %s (tolerance %+.0f%%)\n", pBaselineName, settings.m_tolerance * 100.0);
+		for (const RunResult &result : results) {
+			auto it = baseline.find(RunKey(result.m_ballNum, result.m_wallNum, result.m_threadNum));
+			if (it == baseline.end() || it->second <= 0.0)
+				continue;
+
+			double change = result.m_nsPerBall / it->second - 1.0;
+			bool slower = change > settings.m_tolerance;
+			ok = ok && !slower;
+			printf("balls %8u  walls %6u  threads %2u  %8.2f -> %8.2f ns/ball/frame  %+6.1f%%%s\n",
+				result.m_ballNum, result.m_wallNum, result.m_threadNum, it->second, result.m_nsPerBall,
+				change * 100.0, slower ? "  SLOWER" : "");
+		}
+	}
+
+	return ok ? 0 : 1;
+}
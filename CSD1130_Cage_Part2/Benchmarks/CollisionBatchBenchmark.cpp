@@ -0,0 +1,308 @@
+/******************************************************************************/
+/*!
+\file		CollisionBatchBenchmark.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Checks CollisionIntersectionBatch_CirclesLineSegment and
+			CollisionIntersectionBatch_CircleLineSegments against
+			CollisionIntersection_CircleLineSegment on random pairs covering
+			the LNS1, LNS2 and between-lines cases, and reports the speedup
+			of the batched kernels.
+
+			Build from the project folder, e.g.
+			g++ -O2 -std=c++17 [-mavx2] -IInclude
+				Source/Collision.cpp Source/CollisionBatch.cpp
+				Benchmarks/CollisionBatchBenchmark.cpp
+			cl /O2 /EHsc [/arch:AVX2] /IInclude <same sources>
+			or through the CollisionBatchBenchmark target of CMakeLists.txt.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CollisionBatch.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	const unsigned int	BALL_NUM		= 4096;
+	const unsigned int	SEGMENT_NUM		= 4096;
+	const int			REPEAT_NUM		= 20;
+
+	// Structure of arrays holding one CollisionBatchResult worth of data
+	struct ResultArrays
+	{
+		std::vector<int>	hit;
+		std::vector<float>	interTime, interPtX, interPtY, normalX, normalY;
+
+		explicit ResultArrays(unsigned int num) :
+			hit(num), interTime(num), interPtX(num), interPtY(num), normalX(num), normalY(num) {}
+
+		CollisionBatchResult View()
+		{
+			return { hit.data(), interTime.data(), interPtX.data(), interPtY.data(), normalX.data(), normalY.data() };
+		}
+	};
+
+	// Same thing for the inputs
+	struct CircleArrays
+	{
+		std::vector<float>	startX, startY, endX, endY, radius;
+	};
+
+	struct SegmentArrays
+	{
+		std::vector<LineSegment>	segments;
+		std::vector<float>			pt0X, pt0Y, pt1X, pt1Y, normalX, normalY, dirX, dirY, length, NP0;
+	};
+
+	double NowMs()
+	{
+		return std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**************************************************************************/
+	/*!
+		Scalar reference, same output convention as the batched kernels
+	 */
+	/**************************************************************************/
+	void ScalarPair(const Circle &circle, const CSD1130::Vec2 &ptEnd, const LineSegment &lineSeg,
+		bool checkLineEdges, ResultArrays &out, unsigned int i)
+	{
+		CSD1130::Vec2 interPt, normal;
+		float interTime = 0.0f;
+
+		out.hit[i] = CollisionIntersection_CircleLineSegment(circle, ptEnd, lineSeg, interPt, normal, interTime, checkLineEdges);
+		if (out.hit[i] == 0) {
+			interTime = 0.0f;
+			interPt = normal = CSD1130::Vec2();
+		}
+
+		out.interTime[i]	= interTime;
+		out.interPtX[i]		= interPt.x;
+		out.interPtY[i]		= interPt.y;
+		out.normalX[i]		= normal.x;
+		out.normalY[i]		= normal.y;
+	}
+
+	/**************************************************************************/
+	/*!
+		Compares two results, returns the number of mismatching entries and
+		accumulates the largest absolute difference
+	 */
+	/**************************************************************************/
+	unsigned int Compare(const ResultArrays &a, const ResultArrays &b, unsigned int num, float &maxDiff)
+	{
+		unsigned int mismatch = 0;
+
+		for (unsigned int i = 0; i < num; ++i) {
+			const float *pA[] = { &a.interTime[i], &a.interPtX[i], &a.interPtY[i], &a.normalX[i], &a.normalY[i] };
+			const float *pB[] = { &b.interTime[i], &b.interPtX[i], &b.interPtY[i], &b.normalX[i], &b.normalY[i] };
+
+			bool same = a.hit[i] == b.hit[i];
+			for (int k = 0; k < 5; ++k) {
+				same = same && memcmp(pA[k], pB[k], sizeof(float)) == 0;
+				maxDiff = std::fmax(maxDiff, std::fabs(*pA[k] - *pB[k]));
+			}
+			mismatch += same ? 0 : 1;
+		}
+
+		return mismatch;
+	}
+
+	/**************************************************************************/
+	/*!
+		Places a moving circle around lineSeg so that the start positions
+		cover both half planes and the band between LNS1 and LNS2, and the
+		paths cover the segment, its edges and misses
+	 */
+	/**************************************************************************/
+	void RandomCircleNear(std::mt19937 &rng, const LineSegment &lineSeg, Circle &circle, CSD1130::Vec2 &ptEnd)
+	{
+		std::uniform_real_distribution<float> along(-0.4f, 1.4f), across(-30.0f, 30.0f),
+			radius(1.0f, 10.0f), angle(0.0f, 6.2831853f), speed(0.0f, 40.0f);
+
+		CSD1130::Vec2 dir = lineSeg.m_pt1 - lineSeg.m_pt0;
+		circle.m_center = lineSeg.m_pt0 + dir * along(rng) + lineSeg.m_normal * across(rng);
+		circle.m_radius = radius(rng);
+
+		float a = angle(rng), s = speed(rng);
+		ptEnd = circle.m_center + CSD1130::Vec2(cosf(a) * s, sinf(a) * s);
+	}
+
+	void RandomSegment(std::mt19937 &rng, LineSegment &lineSeg)
+	{
+		std::uniform_real_distribution<float> coord(-200.0f, 200.0f), length(10.0f, 60.0f), angle(0.0f, 6.2831853f);
+
+		CSD1130::Vec2 p0(coord(rng), coord(rng));
+		float a = angle(rng), l = length(rng);
+		BuildLineSegment(lineSeg, p0, p0 + CSD1130::Vec2(cosf(a) * l, sinf(a) * l));
+	}
+
+	// Counts the start cases of a pair the way the scalar test branches
+	void CountCase(const Circle &circle, const LineSegment &lineSeg, unsigned int cases[3])
+	{
+		float d =	CSD1130::Vector2DDotProduct(lineSeg.m_normal, circle.m_center) -
+					CSD1130::Vector2DDotProduct(lineSeg.m_normal, lineSeg.m_pt0);
+		++cases[d <= -circle.m_radius ? 0 : (d >= circle.m_radius ? 1 : 2)];
+	}
+}
+
+/******************************************************************************/
+/*!
+	Runs both benchmarks and prints a short report
+*/
+/******************************************************************************/
+int main()
+{
+	std::mt19937 rng(1130);
+	bool allMatch = true;
+
+	for (int edges = 0; edges < 2; ++edges) {
+		bool checkLineEdges = edges == 1;
+
+		// -------------------------------------------------------------------
+		// N balls against one segment
+		{
+			const unsigned int SEGMENT_TESTS = 64;
+			std::vector<LineSegment> segments(SEGMENT_TESTS);
+			std::vector<CircleArrays> circles(SEGMENT_TESTS);
+			unsigned int cases[3] = {};
+
+			for (unsigned int s = 0; s < SEGMENT_TESTS; ++s) {
+				RandomSegment(rng, segments[s]);
+				CircleArrays &c = circles[s];
+				c.startX.resize(BALL_NUM); c.startY.resize(BALL_NUM);
+				c.endX.resize(BALL_NUM); c.endY.resize(BALL_NUM); c.radius.resize(BALL_NUM);
+
+				for (unsigned int i = 0; i < BALL_NUM; ++i) {
+					Circle circle;
+					CSD1130::Vec2 ptEnd;
+					RandomCircleNear(rng, segments[s], circle, ptEnd);
+					CountCase(circle, segments[s], cases);
+					c.startX[i] = circle.m_center.x; c.startY[i] = circle.m_center.y;
+					c.endX[i] = ptEnd.x; c.endY[i] = ptEnd.y; c.radius[i] = circle.m_radius;
+				}
+			}
+
+			ResultArrays scalar(BALL_NUM), batch(BALL_NUM);
+			CollisionBatchResult batchView = batch.View();
+			double scalarMs = 0.0, batchMs = 0.0;
+			unsigned int mismatch = 0, hits = 0;
+			float maxDiff = 0.0f;
+
+			for (int r = 0; r < REPEAT_NUM; ++r) {
+				for (unsigned int s = 0; s < SEGMENT_TESTS; ++s) {
+					const CircleArrays &c = circles[s];
+
+					double t0 = NowMs();
+					for (unsigned int i = 0; i < BALL_NUM; ++i) {
+						Circle circle;
+						circle.m_center = CSD1130::Vec2(c.startX[i], c.startY[i]);
+						circle.m_radius = c.radius[i];
+						ScalarPair(circle, CSD1130::Vec2(c.endX[i], c.endY[i]), segments[s], checkLineEdges, scalar, i);
+					}
+					double t1 = NowMs();
+					CircleBatch batchIn = { c.startX.data(), c.startY.data(), c.endX.data(), c.endY.data(), c.radius.data() };
+					unsigned int batchHits = CollisionIntersectionBatch_CirclesLineSegment(batchIn, BALL_NUM, segments[s], batchView, checkLineEdges);
+					double t2 = NowMs();
+
+					scalarMs += t1 - t0;
+					batchMs += t2 - t1;
+					if (r == 0) {
+						mismatch += Compare(scalar, batch, BALL_NUM, maxDiff);
+						hits += batchHits;
+					}
+				}
+			}
+
+			allMatch = allMatch && mismatch == 0;
+			printf("balls vs segment    edges=%d  pairs=%u  LNS1/LNS2/between=%u/%u/%u  hits=%u\n",
+				edges, SEGMENT_TESTS * BALL_NUM, cases[0], cases[1], cases[2], hits);
+			printf("    scalar %8.3f ms  batch %8.3f ms  speedup %5.2fx  mismatches %u  max |diff| %g\n",
+				scalarMs, batchMs, scalarMs / batchMs, mismatch, (double)maxDiff);
+		}
+
+		// -------------------------------------------------------------------
+		// One ball against N segments
+		{
+			const unsigned int BALL_TESTS = 64;
+			std::vector<SegmentArrays> segments(BALL_TESTS);
+			std::vector<Circle> balls(BALL_TESTS);
+			std::vector<CSD1130::Vec2> ends(BALL_TESTS);
+			unsigned int cases[3] = {};
+
+			for (unsigned int b = 0; b < BALL_TESTS; ++b) {
+				SegmentArrays &s = segments[b];
+				s.segments.resize(SEGMENT_NUM);
+
+				// Segments are generated around the ball's path
+				LineSegment anchor;
+				RandomSegment(rng, anchor);
+				RandomCircleNear(rng, anchor, balls[b], ends[b]);
+
+				for (unsigned int i = 0; i < SEGMENT_NUM; ++i) {
+					std::uniform_real_distribution<float> offset(-40.0f, 40.0f), length(10.0f, 60.0f), angle(0.0f, 6.2831853f);
+					CSD1130::Vec2 p0 = balls[b].m_center + CSD1130::Vec2(offset(rng), offset(rng));
+					float a = angle(rng), l = length(rng);
+					BuildLineSegment(s.segments[i], p0, p0 + CSD1130::Vec2(cosf(a) * l, sinf(a) * l));
+					CountCase(balls[b], s.segments[i], cases);
+
+					s.pt0X.push_back(s.segments[i].m_pt0.x); s.pt0Y.push_back(s.segments[i].m_pt0.y);
+					s.pt1X.push_back(s.segments[i].m_pt1.x); s.pt1Y.push_back(s.segments[i].m_pt1.y);
+					s.normalX.push_back(s.segments[i].m_normal.x); s.normalY.push_back(s.segments[i].m_normal.y);
+					s.dirX.push_back(s.segments[i].m_dir.x); s.dirY.push_back(s.segments[i].m_dir.y);
+					s.length.push_back(s.segments[i].m_length); s.NP0.push_back(s.segments[i].m_NP0);
+				}
+			}
+
+			ResultArrays scalar(SEGMENT_NUM), batch(SEGMENT_NUM);
+			CollisionBatchResult batchView = batch.View();
+			double scalarMs = 0.0, batchMs = 0.0;
+			unsigned int mismatch = 0, hits = 0;
+			float maxDiff = 0.0f;
+
+			for (int r = 0; r < REPEAT_NUM; ++r) {
+				for (unsigned int b = 0; b < BALL_TESTS; ++b) {
+					const SegmentArrays &s = segments[b];
+
+					double t0 = NowMs();
+					for (unsigned int i = 0; i < SEGMENT_NUM; ++i)
+						ScalarPair(balls[b], ends[b], s.segments[i], checkLineEdges, scalar, i);
+					double t1 = NowMs();
+					SegmentBatch batchIn = { s.pt0X.data(), s.pt0Y.data(), s.pt1X.data(), s.pt1Y.data(), s.normalX.data(), s.normalY.data(),
+						s.dirX.data(), s.dirY.data(), s.length.data(), s.NP0.data() };
+					unsigned int batchHits = CollisionIntersectionBatch_CircleLineSegments(balls[b], ends[b], batchIn, SEGMENT_NUM, batchView, checkLineEdges);
+					double t2 = NowMs();
+
+					scalarMs += t1 - t0;
+					batchMs += t2 - t1;
+					if (r == 0) {
+						mismatch += Compare(scalar, batch, SEGMENT_NUM, maxDiff);
+						hits += batchHits;
+					}
+				}
+			}
+
+			allMatch = allMatch && mismatch == 0;
+			printf("ball vs segments    edges=%d  pairs=%u  LNS1/LNS2/between=%u/%u/%u  hits=%u\n",
+				edges, BALL_TESTS * SEGMENT_NUM, cases[0], cases[1], cases[2], hits);
+			printf("    scalar %8.3f ms  batch %8.3f ms  speedup %5.2fx  mismatches %u  max |diff| %g\n",
+				scalarMs, batchMs, scalarMs / batchMs, mismatch, (double)maxDiff);
+		}
+	}
+
+	printf(allMatch ? "batched results are bit-identical to the scalar test\n"
+					: "batched results differ from the scalar test\n");
+	return allMatch ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/******************************************************************************/
+/*!
+\file		MathInlineBenchmark.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Times CollisionIntersection_CircleLineSegment built on the header
+			only math library against the same test built on the former
+			out-of-line Vector2D functions (MathOutOfLine.h), checks that
+			both give bit-identical results, and does the same for
+			Vector2DSquareDistance/Vector2DDistance without powf.
+
+			Build from the project folder, e.g.
+			g++ -O2 -std=c++17 -IInclude Source/Collision.cpp
+				Benchmarks/MathOutOfLine.cpp Benchmarks/MathOutOfLineCollision.cpp
+				Benchmarks/MathInlineBenchmark.cpp
+			cl /O2 /EHsc /IInclude <same sources>
+			or through the MathInlineBenchmark target of CMakeLists.txt.
+			Whole program optimization (/GL, -flto) would inline the old
+			functions too and hide the difference.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "MathOutOfLine.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	const unsigned int	PAIR_NUM		= 1 << 18;
+	const unsigned int	POINT_NUM		= 1 << 16;
+	const int			REPEAT_NUM		= 20;
+
+	// Compile time checks of the constexpr math
+	static_assert(CSD1130::Vector2DDotProduct(CSD1130::Vec2(1.0f, 2.0f), CSD1130::Vec2(3.0f, 4.0f)) == 11.0f, "constexpr dot product");
+	static_assert(CSD1130::Vector2DSquareDistance(CSD1130::Vec2(1.0f, 2.0f), CSD1130::Vec2(4.0f, 6.0f)) == 25.0f, "constexpr square distance");
+	static_assert((CSD1130::Vec2(1.0f, 2.0f) * 2.0f - CSD1130::Vec2(0.5f, 0.5f)).y == 3.5f, "constexpr operators");
+
+	struct Pair
+	{
+		Circle			m_circle;
+		CSD1130::Vec2	m_ptEnd;
+		LineSegment		m_lineSeg;
+	};
+
+	struct Result
+	{
+		int				m_hit;
+		float			m_interTime;
+		CSD1130::Vec2	m_interPt;
+		CSD1130::Vec2	m_normal;
+	};
+
+	typedef int (*IntersectFunc)(const Circle &, const CSD1130::Vec2 &, const LineSegment &,
+		CSD1130::Vec2 &, CSD1130::Vec2 &, float &, bool &);
+
+	double NowMs()
+	{
+		return std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**************************************************************************/
+	/*!
+		Random segment with a moving circle around it, so that the start
+		positions cover both half planes and the band between LNS1 and
+		LNS2, and the paths cover the segment, its edges and misses
+	 */
+	/**************************************************************************/
+	void RandomPair(std::mt19937 &rng, Pair &pair)
+	{
+		std::uniform_real_distribution<float> coord(-200.0f, 200.0f), length(10.0f, 60.0f), angle(0.0f, 6.2831853f),
+			along(-0.4f, 1.4f), across(-30.0f, 30.0f), radius(1.0f, 10.0f), speed(0.0f, 40.0f);
+
+		CSD1130::Vec2 p0(coord(rng), coord(rng));
+		float a = angle(rng), l = length(rng);
+		BuildLineSegment(pair.m_lineSeg, p0, p0 + CSD1130::Vec2(cosf(a) * l, sinf(a) * l));
+
+		const LineSegment &lineSeg = pair.m_lineSeg;
+		pair.m_circle.m_center = lineSeg.m_pt0 + (lineSeg.m_pt1 - lineSeg.m_pt0) * along(rng) + lineSeg.m_normal * across(rng);
+		pair.m_circle.m_radius = radius(rng);
+
+		float b = angle(rng), s = speed(rng);
+		pair.m_ptEnd = pair.m_circle.m_center + CSD1130::Vec2(cosf(b) * s, sinf(b) * s);
+	}
+
+	// Runs func on every pair REPEAT_NUM times, returns the time in ms
+	double TimeIntersect(IntersectFunc func, const std::vector<Pair> &pairs, bool checkLineEdges, std::vector<Result> &results)
+	{
+		double t0 = NowMs();
+
+		for (int r = 0; r < REPEAT_NUM; ++r) {
+			for (size_t i = 0; i < pairs.size(); ++i) {
+				Result &result = results[i];
+				result.m_interTime = 0.0f;
+				result.m_interPt = result.m_normal = CSD1130::Vec2();
+				result.m_hit = func(pairs[i].m_circle, pairs[i].m_ptEnd, pairs[i].m_lineSeg,
+					result.m_interPt, result.m_normal, result.m_interTime, checkLineEdges);
+			}
+		}
+
+		return NowMs() - t0;
+	}
+
+	// Runs func on consecutive points REPEAT_NUM times, returns the time in ms
+	template <typename DistanceFunc>
+	double TimeDistance(DistanceFunc func, const std::vector<CSD1130::Vec2> &points, std::vector<float> &results)
+	{
+		double t0 = NowMs();
+
+		for (int r = 0; r < REPEAT_NUM; ++r)
+			for (size_t i = 0; i + 1 < points.size(); ++i)
+				results[i] = func(points[i], points[i + 1]);
+
+		return NowMs() - t0;
+	}
+}
+
+/******************************************************************************/
+/*!
+	Runs the benchmarks and prints a short report
+*/
+/******************************************************************************/
+int main()
+{
+	std::mt19937 rng(1130);
+	bool allMatch = true;
+
+	std::vector<Pair> pairs(PAIR_NUM);
+	for (Pair &pair : pairs)
+		RandomPair(rng, pair);
+
+	// -----------------------------------------------------------------------
+	// CollisionIntersection_CircleLineSegment
+	for (int edges = 0; edges < 2; ++edges) {
+		bool checkLineEdges = edges == 1;
+		std::vector<Result> outOfLine(PAIR_NUM), inlined(PAIR_NUM);
+
+		double outOfLineMs	= TimeIntersect(MathOutOfLine::CollisionIntersection_CircleLineSegment, pairs, checkLineEdges, outOfLine);
+		double inlinedMs	= TimeIntersect(CollisionIntersection_CircleLineSegment, pairs, checkLineEdges, inlined);
+
+		unsigned int mismatch = 0, hits = 0;
+		for (unsigned int i = 0; i < PAIR_NUM; ++i) {
+			mismatch += memcmp(&outOfLine[i], &inlined[i], sizeof(Result)) == 0 ? 0 : 1;
+			hits += inlined[i].m_hit;
+		}
+
+		allMatch = allMatch && mismatch == 0;
+		printf("circle vs segment   edges=%d  pairs=%u x %d  hits=%u\n", edges, PAIR_NUM, REPEAT_NUM, hits);
+		printf("    out-of-line %8.3f ms  inline %8.3f ms  speedup %5.2fx  mismatches %u\n",
+			outOfLineMs, inlinedMs, outOfLineMs / inlinedMs, mismatch);
+	}
+
+	// -----------------------------------------------------------------------
+	// Vector2DSquareDistance and Vector2DDistance, powf against x * x
+	{
+		std::uniform_real_distribution<float> coord(-1000.0f, 1000.0f);
+		std::vector<CSD1130::Vec2> points(POINT_NUM);
+		for (CSD1130::Vec2 &point : points)
+			point = CSD1130::Vec2(coord(rng), coord(rng));
+
+		const char *names[] = { "square distance", "distance" };
+
+		for (int k = 0; k < 2; ++k) {
+			std::vector<float> outOfLine(POINT_NUM), inlined(POINT_NUM);
+			double outOfLineMs, inlinedMs;
+
+			if (k == 0) {
+				outOfLineMs	= TimeDistance(MathOutOfLine::Vector2DSquareDistance, points, outOfLine);
+				inlinedMs	= TimeDistance([](const CSD1130::Vec2 &a, const CSD1130::Vec2 &b) {
+					return CSD1130::Vector2DSquareDistance(a, b); }, points, inlined);
+			}
+			else {
+				outOfLineMs	= TimeDistance(MathOutOfLine::Vector2DDistance, points, outOfLine);
+				inlinedMs	= TimeDistance([](const CSD1130::Vec2 &a, const CSD1130::Vec2 &b) {
+					return CSD1130::Vector2DDistance(a, b); }, points, inlined);
+			}
+
+			// powf(x, 2) is not required to be exact, so only report how far off
+			unsigned int mismatch = 0;
+			float maxRelDiff = 0.0f;
+			for (unsigned int i = 0; i + 1 < POINT_NUM; ++i) {
+				mismatch += outOfLine[i] == inlined[i] ? 0 : 1;
+				if (inlined[i] != 0.0f)
+					maxRelDiff = std::fmax(maxRelDiff, std::fabs(outOfLine[i] - inlined[i]) / inlined[i]);
+			}
+
+			printf("%-19s pairs=%u x %d\n", names[k], POINT_NUM - 1, REPEAT_NUM);
+			printf("    out-of-line %8.3f ms  inline %8.3f ms  speedup %5.2fx  differences %u  max rel. diff %g\n",
+				outOfLineMs, inlinedMs, outOfLineMs / inlinedMs, mismatch, (double)maxRelDiff);
+		}
+	}
+
+	printf(allMatch ? "inline results are bit-identical to the out-of-line ones\n"
+					: "inline results differ from the out-of-line ones\n");
+	return allMatch ? 0 : 1;
+}
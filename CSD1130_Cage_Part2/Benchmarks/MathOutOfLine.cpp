@@ -0,0 +1,81 @@
+/******************************************************************************/
+/*!
+\file		MathOutOfLine.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		The out-of-line Vector2D functions of MathOutOfLine.h, as they
+			were in Vector2D.cpp.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "MathOutOfLine.h"
+#include <math.h>
+
+namespace MathOutOfLine
+{
+	// The assignment operators did the work and the binary ones copied
+	CSD1130::Vec2 Add(const CSD1130::Vec2 &lhs, const CSD1130::Vec2 &rhs) {
+		CSD1130::Vec2 tmp = lhs;
+		tmp.x += rhs.x;
+		tmp.y += rhs.y;
+		return tmp;
+	}
+
+	CSD1130::Vec2 Sub(const CSD1130::Vec2 &lhs, const CSD1130::Vec2 &rhs) {
+		CSD1130::Vec2 tmp = lhs;
+		tmp.x -= rhs.x;
+		tmp.y -= rhs.y;
+		return tmp;
+	}
+
+	CSD1130::Vec2 Mul(const CSD1130::Vec2 &lhs, float rhs) {
+		CSD1130::Vec2 tmp = lhs;
+		tmp.x *= rhs;
+		tmp.y *= rhs;
+		return tmp;
+	}
+
+	CSD1130::Vec2 Mul(float lhs, const CSD1130::Vec2 &rhs) {
+		CSD1130::Vec2 tmp = rhs;
+		tmp.x *= lhs;
+		tmp.y *= lhs;
+		return tmp;
+	}
+
+	CSD1130::Vec2 Div(const CSD1130::Vec2 &lhs, float rhs) {
+		CSD1130::Vec2 tmp = lhs;
+		tmp.x /= rhs;
+		tmp.y /= rhs;
+		return tmp;
+	}
+
+	CSD1130::Vec2 Neg(const CSD1130::Vec2 &vec) {
+		CSD1130::Vec2 tmp(-vec.x, -vec.y);
+		return tmp;
+	}
+
+	void Vector2DNormalize(CSD1130::Vec2 &pResult, const CSD1130::Vec2 &pVec0) {
+		pResult = Div(pVec0, MathOutOfLine::Vector2DLength(pVec0));
+	}
+
+	float Vector2DLength(const CSD1130::Vec2 &pVec0) {
+		return (sqrtf(pVec0.x * pVec0.x + pVec0.y * pVec0.y));
+	}
+
+	float Vector2DDistance(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1) {
+		return (sqrtf(powf(pVec1.x - pVec0.x, 2.0f) + powf(pVec1.y - pVec0.y, 2.0f)));
+	}
+
+	float Vector2DSquareDistance(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1) {
+		return (powf(pVec1.x - pVec0.x, 2.0f) + powf(pVec1.y - pVec0.y, 2.0f));
+	}
+
+	float Vector2DDotProduct(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1) {
+		return (pVec0.x * pVec1.x + pVec0.y * pVec1.y);
+	}
+}
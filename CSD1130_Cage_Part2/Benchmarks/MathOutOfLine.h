@@ -0,0 +1,65 @@
+/******************************************************************************/
+/*!
+\file		MathOutOfLine.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		The Vector2D functions and CollisionIntersection_CircleLineSegment
+			as they were before the math library became header only, kept
+			for MathInlineBenchmark.cpp.
+
+			The functions are defined in MathOutOfLine.cpp and used from
+			MathOutOfLineCollision.cpp, so every operator is a call into
+			another translation unit like it was from Collision.cpp. The
+			operators are written as named functions because the CSD1130
+			operators are now inline, and the calls are qualified because
+			argument dependent lookup also finds the CSD1130 and Collision.h
+			functions.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_MATH_OUT_OF_LINE_H_
+#define CSD1130_MATH_OUT_OF_LINE_H_
+
+#include "Collision.h"
+
+namespace MathOutOfLine
+{
+	// Operators of Vector2D.cpp
+	CSD1130::Vec2	Add(const CSD1130::Vec2 &lhs, const CSD1130::Vec2 &rhs);
+	CSD1130::Vec2	Sub(const CSD1130::Vec2 &lhs, const CSD1130::Vec2 &rhs);
+	CSD1130::Vec2	Mul(const CSD1130::Vec2 &lhs, float rhs);
+	CSD1130::Vec2	Mul(float lhs, const CSD1130::Vec2 &rhs);
+	CSD1130::Vec2	Div(const CSD1130::Vec2 &lhs, float rhs);
+	CSD1130::Vec2	Neg(const CSD1130::Vec2 &vec);
+
+	// Functions of Vector2D.cpp
+	void	Vector2DNormalize(CSD1130::Vec2 &pResult, const CSD1130::Vec2 &pVec0);
+	float	Vector2DLength(const CSD1130::Vec2 &pVec0);
+	float	Vector2DDistance(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1);
+	float	Vector2DSquareDistance(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1);
+	float	Vector2DDotProduct(const CSD1130::Vec2 &pVec0, const CSD1130::Vec2 &pVec1);
+
+	// Collision.cpp on top of them
+	int CollisionIntersection_CircleLineSegment(const Circle &circle,
+		const CSD1130::Vec2 &ptEnd,
+		const LineSegment &lineSeg,
+		CSD1130::Vec2 &interPt,
+		CSD1130::Vec2 &normalAtCollision,
+		float &interTime,
+		bool &checkLineEdges);
+
+	int CheckMovingCircleToLineEdge(bool withinBothLines,
+		const Circle &circle,
+		const CSD1130::Vec2 &ptEnd,
+		const LineSegment &lineSeg,
+		CSD1130::Vec2 &interPt,
+		CSD1130::Vec2 &normalAtCollision,
+		float &interTime);
+}
+
+#endif // CSD1130_MATH_OUT_OF_LINE_H_
@@ -0,0 +1,197 @@
+/******************************************************************************/
+/*!
+\file		MathOutOfLineCollision.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		CollisionIntersection_CircleLineSegment and
+			CheckMovingCircleToLineEdge of Collision.cpp with every vector
+			operation going through the out-of-line functions of
+			MathOutOfLine.cpp. The comments of Collision.cpp are left out,
+			the statements are the same in the same order.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "MathOutOfLine.h"
+#include <cmath>
+
+namespace MathOutOfLine
+{
+	int CollisionIntersection_CircleLineSegment(const Circle &circle,
+		const CSD1130::Vec2 &ptEnd,
+		const LineSegment &lineSeg,
+		CSD1130::Vec2 &interPt,
+		CSD1130::Vec2 &normalAtCollision,
+		float &interTime,
+		bool &checkLineEdges)
+	{
+		CSD1130::Vec2 V = Sub(ptEnd, circle.m_center);
+		CSD1130::Vec2 M(V.y, -V.x);
+
+		float			NBs = MathOutOfLine::Vector2DDotProduct(lineSeg.m_normal, circle.m_center),
+						NP0 = lineSeg.m_NP0,
+						NV	= MathOutOfLine::Vector2DDotProduct(lineSeg.m_normal, V);
+
+		CSD1130::Vec2	BsP0 = Sub(lineSeg.m_pt0, circle.m_center);
+
+		float			MBsP0 = MathOutOfLine::Vector2DDotProduct(M, BsP0),
+						RVD = circle.m_radius * MathOutOfLine::Vector2DDotProduct(V, lineSeg.m_dir),
+						LNV = lineSeg.m_length * NV,
+						MBsP0prime,
+						MBsP1prime;
+
+		if (NBs - NP0 <= -circle.m_radius) {
+			MBsP0prime = MBsP0 - RVD;
+			MBsP1prime = MBsP0prime - LNV;
+
+			if (MBsP0prime * MBsP1prime < 0) {
+				interTime = (NP0 - NBs - circle.m_radius) / (NV);
+				if (0 <= interTime && interTime <= 1) {
+					interPt				= Add(circle.m_center, Mul(V, interTime));
+					normalAtCollision	= Neg(lineSeg.m_normal);
+					return 1;
+				}
+			}
+			else if (checkLineEdges)
+				return MathOutOfLine::CheckMovingCircleToLineEdge(false, circle, ptEnd, lineSeg, interPt, normalAtCollision, interTime);
+		}
+		else if (NBs - NP0 >= circle.m_radius) {
+			MBsP0prime = MBsP0 + RVD;
+			MBsP1prime = MBsP0prime - LNV;
+
+			if (MBsP0prime * MBsP1prime < 0) {
+				interTime = (NP0 - NBs + circle.m_radius) / (NV);
+				if (0 <= interTime && interTime <= 1) {
+					interPt				= Add(circle.m_center, Mul(V, interTime));
+					normalAtCollision	= lineSeg.m_normal;
+					return 1;
+				}
+			}
+			else if (checkLineEdges)
+				return MathOutOfLine::CheckMovingCircleToLineEdge(false, circle, ptEnd, lineSeg, interPt, normalAtCollision, interTime);
+		}
+		else if (checkLineEdges)
+			return MathOutOfLine::CheckMovingCircleToLineEdge(true, circle, ptEnd, lineSeg, interPt, normalAtCollision, interTime);
+
+		return 0;
+	}
+
+	int CheckMovingCircleToLineEdge(bool withinBothLines,
+		const Circle &circle,
+		const CSD1130::Vec2 &ptEnd,
+		const LineSegment &lineSeg,
+		CSD1130::Vec2 &interPt,
+		CSD1130::Vec2 &normalAtCollision,
+		float &interTime)
+	{
+		CSD1130::Vec2 BsP0 = Sub(lineSeg.m_pt0, circle.m_center);
+		CSD1130::Vec2 BsP1 = Sub(lineSeg.m_pt1, circle.m_center);
+		float BsP0P0P1 = MathOutOfLine::Vector2DDotProduct(BsP0, lineSeg.m_dir);
+
+		CSD1130::Vec2 V = Sub(ptEnd, circle.m_center);
+		float lengthV = MathOutOfLine::Vector2DLength(V);
+		CSD1130::Vec2 Vnorm = Div(V, lengthV);
+		CSD1130::Vec2 M(Vnorm.y, -Vnorm.x);
+
+		float m, s, dist0, dist1;
+
+		if (withinBothLines) {
+			if (BsP0P0P1 > 0) {
+				if ((m = MathOutOfLine::Vector2DDotProduct(BsP0, Vnorm)) > 0) {
+					dist0 = MathOutOfLine::Vector2DDotProduct(BsP0, M);
+					if (std::abs(dist0) > circle.m_radius)
+						return 0;
+
+					s = sqrt(circle.m_radius * circle.m_radius - dist0 * dist0);
+					interTime = (m - s) / lengthV;
+					if (interTime <= 1) {
+						interPt = Add(circle.m_center, Mul(V, interTime));
+
+						CSD1130::Vec2 P0Bi = Sub(interPt, lineSeg.m_pt0);
+						MathOutOfLine::Vector2DNormalize(normalAtCollision, P0Bi);
+						return 1;
+					}
+				}
+			}
+			else {
+				if ((m = MathOutOfLine::Vector2DDotProduct(BsP1, Vnorm)) > 0) {
+					dist1 = MathOutOfLine::Vector2DDotProduct(BsP1, M);
+					if (std::abs(dist1) > circle.m_radius)
+						return 0;
+
+					s = sqrt(circle.m_radius * circle.m_radius - dist1 * dist1);
+					interTime = (m - s) / lengthV;
+					if (interTime <= 1) {
+						interPt = Add(circle.m_center, Mul(V, interTime));
+
+						CSD1130::Vec2 P1Bi = Sub(interPt, lineSeg.m_pt1);
+						MathOutOfLine::Vector2DNormalize(normalAtCollision, P1Bi);
+						return 1;
+					}
+				}
+			}
+		}
+		else {
+			bool P0Side = false;
+			dist0 = MathOutOfLine::Vector2DDotProduct(BsP0, M);
+			dist1 = MathOutOfLine::Vector2DDotProduct(BsP1, M);
+
+			float dist0_abs = std::abs(dist0);
+			float dist1_abs = std::abs(dist1);
+
+			if ((dist0_abs > circle.m_radius) && (dist1_abs > circle.m_radius))
+				return 0;
+
+			else if ((dist0_abs <= circle.m_radius) && (dist1_abs <= circle.m_radius)) {
+				float m0 = MathOutOfLine::Vector2DDotProduct(BsP0, V);
+				float m1 = MathOutOfLine::Vector2DDotProduct(BsP1, V);
+
+				float m0_abs = std::abs(m0);
+				float m1_abs = std::abs(m1);
+
+				P0Side = (m0_abs < m1_abs);
+			}
+			else if (dist0_abs <= circle.m_radius)
+				P0Side = true;
+			else
+				P0Side = false;
+
+			if (P0Side) {
+				if ((m = MathOutOfLine::Vector2DDotProduct(BsP0, Vnorm)) < 0)
+					return 0;
+				else {
+					s = sqrt(circle.m_radius * circle.m_radius - dist0 * dist0);
+					interTime = (m - s) / lengthV;
+					if (interTime <= 1) {
+						interPt = Add(circle.m_center, Mul(V, interTime));
+
+						CSD1130::Vec2 P0Bi = Sub(interPt, lineSeg.m_pt0);
+						MathOutOfLine::Vector2DNormalize(normalAtCollision, P0Bi);
+						return 1;
+					}
+				}
+			}
+			else {
+				if ((m = MathOutOfLine::Vector2DDotProduct(BsP1, Vnorm)) < 0)
+					return 0;
+				else {
+					s = sqrt(circle.m_radius * circle.m_radius - dist1 * dist1);
+					interTime = (m - s) / lengthV;
+					if (interTime <= 1) {
+						interPt = Add(circle.m_center, Mul(V, interTime));
+
+						CSD1130::Vec2 P1Bi = Sub(interPt, lineSeg.m_pt1);
+						MathOutOfLine::Vector2DNormalize(normalAtCollision, P1Bi);
+						return 1;
+					}
+				}
+			}
+		}
+
+		return 0;
+	}
+}
@@ -0,0 +1,553 @@
+/******************************************************************************/
+/*!
+\file		MicroBenchmark.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Microbenchmarks of Collision.cpp and of the CSD1130 math library,
+			meant to be run on every commit and compared: the time per call
+			of CollisionIntersection_CircleLineSegment in each of its
+			branches (LNS1, LNS2, between the lines, line edge hit, miss),
+			of CheckMovingCircleToLineEdge, of
+			CollisionResponse_CircleLineSegment, of the Matrix3x3 operators
+			and Mtx33Inverse, and of the Vector2D normalize functions.
+
+			Each benchmark calls the function on CASE_NUM independent cases
+			(a pass), so the time is the throughput of the call with its
+			inputs in cache and one branch taken, not its latency. The
+			collision cases are random pairs sorted by the branch they
+			take. The number of passes is set so that a repetition lasts
+			-mintime ms, and the median and the fastest repetition are
+			reported in ns per call.
+
+			Usage:
+			MicroBenchmark [-json results.json] [-filter text] [-mintime ms]
+						   [-repeat N] [-label text]
+
+			-json		also write the results to a JSON file
+			-filter		only run the benchmarks whose name contains text
+			-mintime	time of a repetition (default 100)
+			-repeat		repetitions of each benchmark (default 5)
+			-label		stored in the JSON file, e.g. the commit hash
+
+			JSON layout:
+			{ "context": { "label", "compiler", "fast_normalize",
+						   "mintime_ms", "repetitions" },
+			  "benchmarks": [ { "name", "cases", "passes", "ns_median",
+								"ns_min", "calls_per_second", "hits" } ] }
+			"hits" is the number of cases of the pass where the test
+			returns a collision, -1 for the other functions.
+
+			Build from the project folder, e.g.
+			g++ -O2 -std=c++17 -IInclude Source/Collision.cpp
+				Benchmarks/MicroBenchmark.cpp
+			cl /O2 /EHsc /IInclude <same sources>
+			or through the MicroBenchmark target of CMakeLists.txt.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "Collision.h"
+#include "Matrix3x3.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	const unsigned int	CASE_NUM		= 1024;
+	const unsigned int	PAIR_TRY_MAX	= 1 << 24;		// random pairs tried to fill the collision cases
+
+	struct BenchSettings
+	{
+		std::string		m_filter;
+		double			m_minTimeMs		= 100.0;
+		int				m_repeatNum		= 5;
+	};
+
+	struct BenchResult
+	{
+		std::string			m_name;
+		unsigned long long	m_passNum{};
+		double				m_nsMedian{};
+		double				m_nsMin{};
+		int					m_hits{ -1 };
+	};
+
+	struct Pair
+	{
+		Circle			m_circle;
+		CSD1130::Vec2	m_ptEnd;
+		LineSegment		m_lineSeg;
+	};
+
+	// Branches of CollisionIntersection_CircleLineSegment
+	enum PairKind
+	{
+		PAIR_LNS1 = 0,			// starts on the -N side, hits the segment
+		PAIR_LNS2,				// starts on the +N side, hits the segment
+		PAIR_BETWEEN,			// starts between LNS1 and LNS2
+		PAIR_EDGE,				// starts outside of the band, hits an end point
+		PAIR_MISS,				// starts outside of the band, no collision
+		PAIR_KIND_NUM
+	};
+
+	const char *const PAIR_KIND_NAMES[PAIR_KIND_NUM] = { "lns1", "lns2", "between", "edge", "miss" };
+
+	volatile float	sSink;		// results end here so that the calls are not optimized out
+
+	double NowMs()
+	{
+		return std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// The compiler cannot tell that a pass reads the same data as the last one
+	template <typename T>
+	const T *Opaque(const T *p)
+	{
+		const T *volatile pOpaque = p;
+		return pOpaque;
+	}
+
+	/**************************************************************************/
+	/*!
+		Times pass, which makes CASE_NUM calls and returns a value of their
+		results, and fills result with the time per call
+	 */
+	/**************************************************************************/
+	template <typename PassFunc>
+	void RunBenchmark(const BenchSettings &settings, const char *pName, int hits, PassFunc pass,
+		std::vector<BenchResult> &results)
+	{
+		if (!settings.m_filter.empty() && strstr(pName, settings.m_filter.c_str()) == NULL)
+			return;
+
+		// passes of one repetition, doubled until it is long enough to scale
+		unsigned long long passNum = 1;
+		float sum = 0.0f;
+		for (;;) {
+			double t0 = NowMs();
+			for (unsigned long long p = 0; p < passNum; ++p)
+				sum += pass();
+			double elapsedMs = NowMs() - t0;
+
+			if (elapsedMs >= settings.m_minTimeMs * 0.1 || passNum >= (1ull << 40)) {
+				passNum = std::max(1ull, (unsigned long long)((double)passNum * settings.m_minTimeMs / std::max(elapsedMs, 1.0e-3)));
+				break;
+			}
+			passNum *= 2;
+		}
+
+		std::vector<double> nsPerCall;
+		for (int r = 0; r < settings.m_repeatNum; ++r) {
+			double t0 = NowMs();
+			for (unsigned long long p = 0; p < passNum; ++p)
+				sum += pass();
+			nsPerCall.push_back((NowMs() - t0) * 1.0e6 / ((double)passNum * CASE_NUM));
+		}
+		sSink = sum;
+
+		std::sort(nsPerCall.begin(), nsPerCall.end());
+
+		BenchResult result;
+		result.m_name		= pName;
+		result.m_passNum	= passNum;
+		result.m_nsMedian	= nsPerCall[nsPerCall.size() / 2];
+		result.m_nsMin		= nsPerCall.front();
+		result.m_hits		= hits;
+		results.push_back(result);
+
+		printf("%-40s %10.3f ns  (min %8.3f)  %12llu passes", pName, result.m_nsMedian, result.m_nsMin, passNum);
+		if (hits >= 0)
+			printf("  hits %u/%u", (unsigned int)hits, CASE_NUM);
+		printf("\n");
+	}
+
+	/**************************************************************************/
+	/*!
+		Random segment with a moving circle around it, the start positions
+		cover both half planes and the band between LNS1 and LNS2, the paths
+		cover the segment, its edges and misses
+	 */
+	/**************************************************************************/
+	void RandomPair(std::mt19937 &rng, Pair &pair)
+	{
+		std::uniform_real_distribution<float> coord(-200.0f, 200.0f), length(10.0f, 60.0f), angle(0.0f, 6.2831853f),
+			along(-0.4f, 1.4f), across(-30.0f, 30.0f), radius(1.0f, 10.0f), speed(0.0f, 40.0f);
+
+		CSD1130::Vec2 p0(coord(rng), coord(rng));
+		float a = angle(rng), l = length(rng);
+		BuildLineSegment(pair.m_lineSeg, p0, p0 + CSD1130::Vec2(cosf(a) * l, sinf(a) * l));
+
+		const LineSegment &lineSeg = pair.m_lineSeg;
+		pair.m_circle.m_center = lineSeg.m_pt0 + (lineSeg.m_pt1 - lineSeg.m_pt0) * along(rng) + lineSeg.m_normal * across(rng);
+		pair.m_circle.m_radius = radius(rng);
+
+		float b = angle(rng), s = speed(rng);
+		pair.m_ptEnd = pair.m_circle.m_center + CSD1130::Vec2(cosf(b) * s, sinf(b) * s);
+	}
+
+	// Branch the pair takes, with the line edges checked
+	PairKind ClassifyPair(const Pair &pair)
+	{
+		CSD1130::Vec2 interPt, normal;
+		float interTime = 0.0f;
+		bool checkLineEdges = true;
+
+		int hit = CollisionIntersection_CircleLineSegment(pair.m_circle, pair.m_ptEnd, pair.m_lineSeg,
+			interPt, normal, interTime, checkLineEdges);
+
+		float dist = CSD1130::Vector2DDotProduct(pair.m_lineSeg.m_normal, pair.m_circle.m_center) - pair.m_lineSeg.m_NP0;
+		if (std::fabs(dist) < pair.m_circle.m_radius)
+			return PAIR_BETWEEN;
+		if (!hit)
+			return PAIR_MISS;
+		// an end point gives the normal of the impact, LNS1 and LNS2 the
+		// normal of the segment
+		float side = dist < 0.0f ? -1.0f : 1.0f;
+		if (normal.x == side * pair.m_lineSeg.m_normal.x && normal.y == side * pair.m_lineSeg.m_normal.y)
+			return dist < 0.0f ? PAIR_LNS1 : PAIR_LNS2;
+		return PAIR_EDGE;
+	}
+
+	// Fills CASE_NUM pairs of each kind, returns false if a kind is too rare
+	bool MakePairs(std::mt19937 &rng, std::vector<Pair> (&pairs)[PAIR_KIND_NUM])
+	{
+		unsigned int filled = 0;
+		for (unsigned int t = 0; t < PAIR_TRY_MAX && filled < PAIR_KIND_NUM; ++t) {
+			Pair pair;
+			RandomPair(rng, pair);
+
+			std::vector<Pair> &kindPairs = pairs[ClassifyPair(pair)];
+			if (kindPairs.size() < CASE_NUM) {
+				kindPairs.push_back(pair);
+				filled += kindPairs.size() == CASE_NUM ? 1 : 0;
+			}
+		}
+		return filled == PAIR_KIND_NUM;
+	}
+
+	int CountHits(const std::vector<Pair> &pairs, bool checkLineEdges)
+	{
+		int hits = 0;
+		for (const Pair &pair : pairs) {
+			CSD1130::Vec2 interPt, normal;
+			float interTime = 0.0f;
+			bool edges = checkLineEdges;
+			hits += CollisionIntersection_CircleLineSegment(pair.m_circle, pair.m_ptEnd, pair.m_lineSeg,
+				interPt, normal, interTime, edges);
+		}
+		return hits;
+	}
+
+	void WriteJson(const char *pFileName, const std::string &label, const BenchSettings &settings,
+		const std::vector<BenchResult> &results)
+	{
+		std::ofstream outFile(pFileName);
+		if (!outFile.is_open()) {
+			printf("Failed to write %s\n", pFileName);
+			return;
+		}
+
+#if defined(_MSC_VER)
+		std::string compiler = "msvc " + std::to_string(_MSC_VER);
+#elif defined(__clang__)
+		std::string compiler = "clang " __clang_version__;
+#elif defined(__GNUC__)
+		std::string compiler = "gcc " __VERSION__;
+#else
+		std::string compiler = "unknown";
+#endif
+
+		// the names, label and compiler need no escaping but quotes and
+		// backslashes
+		auto quoted = [](const std::string &text) {
+			std::string out = "\"";
+			for (char c : text) {
+				if (c == '"' || c == '\\')
+					out += '\\';
+				out += c;
+			}
+			return out + "\"";
+		};
+
+		outFile << std::setprecision(9);
+		outFile << "{\n";
+		outFile << "\t\"context\": {\n";
+		outFile << "\t\t\"label\": " << quoted(label) << ",\n";
+		outFile << "\t\t\"compiler\": " << quoted(compiler) << ",\n";
+		outFile << "\t\t\"fast_normalize\": " << CSD1130_FAST_NORMALIZE << ",\n";
+		outFile << "\t\t\"mintime_ms\": " << settings.m_minTimeMs << ",\n";
+		outFile << "\t\t\"repetitions\": " << settings.m_repeatNum << "\n";
+		outFile << "\t},\n";
+		outFile << "\t\"benchmarks\": [\n";
+
+		for (size_t i = 0; i < results.size(); ++i) {
+			const BenchResult &result = results[i];
+			outFile << "\t\t{ \"name\": " << quoted(result.m_name)
+				<< ", \"cases\": " << CASE_NUM
+				<< ", \"passes\": " << result.m_passNum
+				<< ", \"ns_median\": " << result.m_nsMedian
+				<< ", \"ns_min\": " << result.m_nsMin
+				<< ", \"calls_per_second\": " << 1.0e9 / result.m_nsMedian
+				<< ", \"hits\": " << result.m_hits
+				<< " }" << (i + 1 < results.size() ? "," : "") << "\n";
+		}
+
+		outFile << "\t]\n";
+		outFile << "}\n";
+	}
+
+	void PrintUsage()
+	{
+		printf("usage: MicroBenchmark [-json results.json] [-filter text] [-mintime ms]\n"
+			"                      [-repeat N] [-label text]\n");
+	}
+}
+
+/******************************************************************************/
+/*!
+	Runs the benchmarks, prints them and writes the JSON file
+*/
+/******************************************************************************/
+int main(int argc, char *argv[])
+{
+	BenchSettings settings;
+	const char *pJsonName = NULL;
+	std::string label;
+
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-json") == 0 && i + 1 < argc)
+			pJsonName = argv[++i];
+		else if (strcmp(argv[i], "-filter") == 0 && i + 1 < argc)
+			settings.m_filter = argv[++i];
+		else if (strcmp(argv[i], "-mintime") == 0 && i + 1 < argc)
+			settings.m_minTimeMs = std::max(atof(argv[++i]), 1.0);
+		else if (strcmp(argv[i], "-repeat") == 0 && i + 1 < argc)
+			settings.m_repeatNum = std::max(atoi(argv[++i]), 1);
+		else if (strcmp(argv[i], "-label") == 0 && i + 1 < argc)
+			label = argv[++i];
+		else {
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	std::mt19937 rng(1130);
+	std::vector<BenchResult> results;
+
+	// -----------------------------------------------------------------------
+	// CollisionIntersection_CircleLineSegment, one branch at a time
+	std::vector<Pair> pairs[PAIR_KIND_NUM];
+	if (!MakePairs(rng, pairs)) {
+		printf("Could not make %u pairs of every kind\n", CASE_NUM);
+		return 1;
+	}
+
+	for (int kind = 0; kind < PAIR_KIND_NUM; ++kind) {
+		for (int edges = 0; edges < 2; ++edges) {
+			// without the edges, an edge or between-lines pair is a plain miss
+			if (edges == 0 && (kind == PAIR_BETWEEN || kind == PAIR_EDGE))
+				continue;
+
+			std::string name = std::string("circle_segment/") + PAIR_KIND_NAMES[kind] + (edges ? "/edges" : "");
+			const std::vector<Pair> &kindPairs = pairs[kind];
+			bool checkLineEdges = edges == 1;
+
+			RunBenchmark(settings, name.c_str(), CountHits(kindPairs, checkLineEdges), [&]() {
+				const Pair *pPairs = Opaque(kindPairs.data());
+				float sum = 0.0f;
+				for (unsigned int i = 0; i < CASE_NUM; ++i) {
+					CSD1130::Vec2 interPt, normal;
+					float interTime = 0.0f;
+					bool lineEdges = checkLineEdges;
+					if (CollisionIntersection_CircleLineSegment(pPairs[i].m_circle, pPairs[i].m_ptEnd, pPairs[i].m_lineSeg,
+							interPt, normal, interTime, lineEdges))
+						sum += interTime;
+				}
+				return sum;
+			}, results);
+		}
+	}
+
+	// -----------------------------------------------------------------------
+	// CheckMovingCircleToLineEdge on its own, from between the lines and
+	// from outside of them
+	for (int within = 1; within >= 0; --within) {
+		const std::vector<Pair> &kindPairs = pairs[within ? PAIR_BETWEEN : PAIR_EDGE];
+		bool withinBothLines = within == 1;
+
+		int hits = 0;
+		for (const Pair &pair : kindPairs) {
+			CSD1130::Vec2 interPt, normal;
+			float interTime = 0.0f;
+			hits += CheckMovingCircleToLineEdge(withinBothLines, pair.m_circle, pair.m_ptEnd, pair.m_lineSeg,
+				interPt, normal, interTime);
+		}
+
+		RunBenchmark(settings, within ? "line_edge/between" : "line_edge/outside", hits, [&]() {
+			const Pair *pPairs = Opaque(kindPairs.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Vec2 interPt, normal;
+				float interTime = 0.0f;
+				if (CheckMovingCircleToLineEdge(withinBothLines, pPairs[i].m_circle, pPairs[i].m_ptEnd, pPairs[i].m_lineSeg,
+						interPt, normal, interTime))
+					sum += interTime;
+			}
+			return sum;
+		}, results);
+	}
+
+	// -----------------------------------------------------------------------
+	// CollisionResponse_CircleLineSegment on the impacts of the LNS1 pairs
+	{
+		struct Impact
+		{
+			CSD1130::Vec2	m_interPt;
+			CSD1130::Vec2	m_normal;
+			CSD1130::Vec2	m_ptEnd;
+		};
+
+		std::vector<Impact> impacts;
+		for (const Pair &pair : pairs[PAIR_LNS1]) {
+			Impact impact;
+			float interTime = 0.0f;
+			bool checkLineEdges = false;
+			CollisionIntersection_CircleLineSegment(pair.m_circle, pair.m_ptEnd, pair.m_lineSeg,
+				impact.m_interPt, impact.m_normal, interTime, checkLineEdges);
+			impact.m_ptEnd = pair.m_ptEnd;
+			impacts.push_back(impact);
+		}
+
+		RunBenchmark(settings, "response/circle_segment", -1, [&]() {
+			const Impact *pImpacts = Opaque(impacts.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Vec2 ptEnd = pImpacts[i].m_ptEnd, reflected;
+				CollisionResponse_CircleLineSegment(pImpacts[i].m_interPt, pImpacts[i].m_normal, ptEnd, reflected);
+				sum += ptEnd.x + reflected.y;
+			}
+			return sum;
+		}, results);
+	}
+
+	// -----------------------------------------------------------------------
+	// Matrix3x3, on invertible transforms and points
+	{
+		std::uniform_real_distribution<float> coord(-500.0f, 500.0f), scale(0.5f, 4.0f), angle(0.0f, 6.2831853f);
+
+		std::vector<CSD1130::Matrix3x3> mtxA(CASE_NUM), mtxB(CASE_NUM);
+		std::vector<CSD1130::Vec2> points(CASE_NUM);
+		for (unsigned int i = 0; i < CASE_NUM; ++i) {
+			CSD1130::Mtx33Compose(mtxA[i], coord(rng), coord(rng), scale(rng), scale(rng), angle(rng));
+			CSD1130::Mtx33Compose(mtxB[i], coord(rng), coord(rng), scale(rng), scale(rng), angle(rng));
+			points[i] = CSD1130::Vec2(coord(rng), coord(rng));
+		}
+
+		RunBenchmark(settings, "matrix/multiply", -1, [&]() {
+			const CSD1130::Matrix3x3 *pA = Opaque(mtxA.data()), *pB = Opaque(mtxB.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Matrix3x3 result = pA[i] * pB[i];
+				sum += result.m02 + result.m11;
+			}
+			return sum;
+		}, results);
+
+		RunBenchmark(settings, "matrix/multiply_assign", -1, [&]() {
+			const CSD1130::Matrix3x3 *pA = Opaque(mtxA.data()), *pB = Opaque(mtxB.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Matrix3x3 result = pA[i];
+				result *= pB[i];
+				sum += result.m02 + result.m11;
+			}
+			return sum;
+		}, results);
+
+		RunBenchmark(settings, "matrix/transform_point", -1, [&]() {
+			const CSD1130::Matrix3x3 *pA = Opaque(mtxA.data());
+			const CSD1130::Vec2 *pPoints = Opaque(points.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Vec2 result = pA[i] * pPoints[i];
+				sum += result.x + result.y;
+			}
+			return sum;
+		}, results);
+
+		RunBenchmark(settings, "matrix/assign", -1, [&]() {
+			const CSD1130::Matrix3x3 *pA = Opaque(mtxA.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Matrix3x3 result;
+				result = pA[i];
+				sum += result.m02 + result.m21;
+			}
+			return sum;
+		}, results);
+
+		RunBenchmark(settings, "matrix/inverse", -1, [&]() {
+			const CSD1130::Matrix3x3 *pA = Opaque(mtxA.data());
+			float sum = 0.0f;
+			for (unsigned int i = 0; i < CASE_NUM; ++i) {
+				CSD1130::Matrix3x3 result;
+				float determinant = 0.0f;
+				CSD1130::Mtx33Inverse(&result, &determinant, pA[i]);
+				sum += result.m02 + determinant;
+			}
+			return sum;
+		}, results);
+	}
+
+	// -----------------------------------------------------------------------
+	// Vector2D normalize, over the lengths of the velocities and normals of
+	// the simulation
+	{
+		std::uniform_real_distribution<float> length(0.01f, 1000.0f), angle(0.0f, 6.2831853f);
+
+		std::vector<CSD1130::Vec2> vectors(CASE_NUM);
+		for (CSD1130::Vec2 &vec : vectors) {
+			float a = angle(rng), l = length(rng);
+			vec = CSD1130::Vec2(cosf(a) * l, sinf(a) * l);
+		}
+
+		auto normalizeBenchmark = [&](const char *pName, auto normalize) {
+			RunBenchmark(settings, pName, -1, [&]() {
+				const CSD1130::Vec2 *pVectors = Opaque(vectors.data());
+				float sum = 0.0f;
+				for (unsigned int i = 0; i < CASE_NUM; ++i) {
+					CSD1130::Vec2 result;
+					normalize(result, pVectors[i]);
+					sum += result.x + result.y;
+				}
+				return sum;
+			}, results);
+		};
+
+		normalizeBenchmark("vector/normalize", [](CSD1130::Vec2 &result, const CSD1130::Vec2 &vec) {
+			CSD1130::Vector2DNormalize(result, vec); });
+		normalizeBenchmark("vector/normalize_exact", [](CSD1130::Vec2 &result, const CSD1130::Vec2 &vec) {
+			CSD1130::Vector2DNormalizeExact(result, vec); });
+		normalizeBenchmark("vector/normalize_fast", [](CSD1130::Vec2 &result, const CSD1130::Vec2 &vec) {
+			CSD1130::Vector2DNormalizeFast(result, vec); });
+	}
+
+	if (pJsonName)
+		WriteJson(pJsonName, label, settings, results);
+	return 0;
+}
@@ -0,0 +1,217 @@
+/******************************************************************************/
+/*!
+\file		NormalizeBenchmark.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Accuracy harness of the fast normalize path. Measures how far
+			CSD1130::Vector2DNormalizeFast is from the exact unit vector
+			(computed in double) over vectors of every magnitude the
+			simulation can see, fails when it is further than
+			VECTOR2D_FAST_NORMALIZE_ERROR, shows what that error does to a
+			reflection of CollisionResponse_CircleLineSegment, checks that
+			the batched normalize is bit-identical to the scalar one, and
+			times the four of them.
+
+			Build from the project folder, e.g.
+			g++ -O2 -std=c++17 [-mavx2] -IInclude
+				Source/Collision.cpp Source/CollisionBatch.cpp
+				Benchmarks/NormalizeBenchmark.cpp
+			cl /O2 /EHsc [/arch:AVX2] /IInclude <same sources>
+			or through the NormalizeBenchmark target of CMakeLists.txt.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CollisionBatch.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	const unsigned int	VECTOR_NUM		= 1 << 20;
+	const int			REPEAT_NUM		= 20;
+
+	// Magnitudes from 1e-15 to 1e15, so that the squared length stays a
+	// normal float
+	const float			MIN_EXPONENT	= -15.0f;
+	const float			MAX_EXPONENT	= 15.0f;
+
+	struct Error
+	{
+		double	m_length{};		// | |result| - 1 |
+		double	m_component{};	// largest | result - exact unit vector | per component
+		double	m_angle{};		// angle between result and the vector, in radians
+	};
+
+	double NowMs()
+	{
+		return std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Error of result as the unit vector of (x, y), computed in double
+	void Measure(float x, float y, const CSD1130::Vec2 &result, Error &error)
+	{
+		double length = std::sqrt((double)x * x + (double)y * y);
+		double ux = x / length, uy = y / length;
+		double rx = result.x, ry = result.y;
+
+		error.m_length		= std::fmax(error.m_length, std::fabs(std::sqrt(rx * rx + ry * ry) - 1.0));
+		error.m_component	= std::fmax(error.m_component, std::fmax(std::fabs(rx - ux), std::fabs(ry - uy)));
+		error.m_angle		= std::fmax(error.m_angle, std::fabs(std::atan2(ux * ry - uy * rx, ux * rx + uy * ry)));
+	}
+
+	// Runs func on every vector REPEAT_NUM times, returns the time in ms
+	template <typename NormalizeFunc>
+	double TimeScalar(NormalizeFunc func, const std::vector<float> &x, const std::vector<float> &y,
+		std::vector<float> &outX, std::vector<float> &outY)
+	{
+		double t0 = NowMs();
+
+		for (int r = 0; r < REPEAT_NUM; ++r) {
+			for (size_t i = 0; i < x.size(); ++i) {
+				CSD1130::Vec2 vec;
+				func(vec, CSD1130::Vec2(x[i], y[i]));
+				outX[i] = vec.x;
+				outY[i] = vec.y;
+			}
+		}
+
+		return NowMs() - t0;
+	}
+
+	// Same for a batched normalize, which works in place
+	double TimeBatch(void (*func)(float *, float *, unsigned int), const std::vector<float> &x, const std::vector<float> &y,
+		std::vector<float> &outX, std::vector<float> &outY)
+	{
+		double t0 = NowMs();
+
+		for (int r = 0; r < REPEAT_NUM; ++r) {
+			outX = x;
+			outY = y;
+			func(outX.data(), outY.data(), (unsigned int)x.size());
+		}
+
+		return NowMs() - t0;
+	}
+
+	unsigned int CountMismatches(const std::vector<float> &aX, const std::vector<float> &aY,
+		const std::vector<float> &bX, const std::vector<float> &bY)
+	{
+		unsigned int mismatch = 0;
+		for (size_t i = 0; i < aX.size(); ++i)
+			mismatch += memcmp(&aX[i], &bX[i], sizeof(float)) == 0 && memcmp(&aY[i], &bY[i], sizeof(float)) == 0 ? 0 : 1;
+		return mismatch;
+	}
+}
+
+/******************************************************************************/
+/*!
+	Runs the checks and prints a short report
+*/
+/******************************************************************************/
+int main()
+{
+	std::mt19937 rng(1130);
+	std::uniform_real_distribution<float> exponent(MIN_EXPONENT, MAX_EXPONENT), angle(0.0f, 6.2831853f);
+
+	// Random directions and magnitudes, plus the axes and the diagonals where
+	// one component is 0 or both are equal
+	const float axes[8][2] = { { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+
+	std::vector<float> x(VECTOR_NUM), y(VECTOR_NUM);
+	for (unsigned int i = 0; i < VECTOR_NUM; ++i) {
+		float length = powf(10.0f, exponent(rng));
+		if (i % 16 == 0) {
+			x[i] = axes[i / 16 % 8][0] * length;
+			y[i] = axes[i / 16 % 8][1] * length;
+		}
+		else {
+			float a = angle(rng);
+			x[i] = cosf(a) * length;
+			y[i] = sinf(a) * length;
+		}
+	}
+
+	// -----------------------------------------------------------------------
+	// Accuracy against the exact unit vector
+	Error exact, fast;
+	for (unsigned int i = 0; i < VECTOR_NUM; ++i) {
+		CSD1130::Vec2 vec(x[i], y[i]), result;
+
+		CSD1130::Vector2DNormalizeExact(result, vec);
+		Measure(x[i], y[i], result, exact);
+
+		CSD1130::Vector2DNormalizeFast(result, vec);
+		Measure(x[i], y[i], result, fast);
+	}
+
+	bool withinBound = fast.m_length <= CSD1130::VECTOR2D_FAST_NORMALIZE_ERROR && fast.m_component <= CSD1130::VECTOR2D_FAST_NORMALIZE_ERROR;
+
+	printf("normalize accuracy  vectors=%u  |v| in [1e%g, 1e%g]\n", VECTOR_NUM, (double)MIN_EXPONENT, (double)MAX_EXPONENT);
+	printf("    exact  max length err %.3g  max component err %.3g  max angle err %.3g rad\n",
+		exact.m_length, exact.m_component, exact.m_angle);
+	printf("    fast   max length err %.3g  max component err %.3g  max angle err %.3g rad  (bound %.3g)\n",
+		fast.m_length, fast.m_component, fast.m_angle, (double)CSD1130::VECTOR2D_FAST_NORMALIZE_ERROR);
+
+	// -----------------------------------------------------------------------
+	// What it does to a reflection: a ball 100 units past an edge, reflected
+	// on the normal from each path
+	{
+		double maxEndDiff = 0.0, maxDirDiff = 0.0;
+		for (unsigned int i = 0; i < VECTOR_NUM; i += 16) {
+			CSD1130::Vec2 normal(x[i], y[i]), exactNormal, fastNormal;
+			CSD1130::Vector2DNormalizeExact(exactNormal, normal);
+			CSD1130::Vector2DNormalizeFast(fastNormal, normal);
+
+			CSD1130::Vec2 ptInter(x[i + 1] * 1.0e-12f, y[i + 1] * 1.0e-12f);
+			CSD1130::Vec2 penetration(x[i + 2], y[i + 2]);
+			CSD1130::Vector2DNormalizeExact(penetration, penetration);
+
+			CSD1130::Vec2 exactEnd = ptInter + penetration * 100.0f, fastEnd = exactEnd, exactDir, fastDir;
+			CollisionResponse_CircleLineSegment(ptInter, exactNormal, exactEnd, exactDir);
+			CollisionResponse_CircleLineSegment(ptInter, fastNormal, fastEnd, fastDir);
+
+			maxEndDiff = std::fmax(maxEndDiff, CSD1130::Vector2DDistance(exactEnd, fastEnd));
+			maxDirDiff = std::fmax(maxDirDiff, CSD1130::Vector2DDistance(exactDir, fastDir));
+		}
+
+		printf("reflection          path=100  max end point diff %.3g  max direction diff %.3g\n", maxEndDiff, maxDirDiff);
+	}
+
+	// -----------------------------------------------------------------------
+	// Batched against scalar, and timings
+	std::vector<float> scalarExactX(VECTOR_NUM), scalarExactY(VECTOR_NUM), scalarFastX(VECTOR_NUM), scalarFastY(VECTOR_NUM);
+	std::vector<float> batchExactX, batchExactY, batchFastX, batchFastY;
+
+	double scalarExactMs	= TimeScalar([](CSD1130::Vec2 &result, const CSD1130::Vec2 &vec) {
+		CSD1130::Vector2DNormalizeExact(result, vec); }, x, y, scalarExactX, scalarExactY);
+	double scalarFastMs		= TimeScalar([](CSD1130::Vec2 &result, const CSD1130::Vec2 &vec) {
+		CSD1130::Vector2DNormalizeFast(result, vec); }, x, y, scalarFastX, scalarFastY);
+	double batchExactMs		= TimeBatch(Vector2DNormalizeBatchExact, x, y, batchExactX, batchExactY);
+	double batchFastMs		= TimeBatch(Vector2DNormalizeBatchFast, x, y, batchFastX, batchFastY);
+
+	unsigned int exactMismatch	= CountMismatches(scalarExactX, scalarExactY, batchExactX, batchExactY);
+	unsigned int fastMismatch	= CountMismatches(scalarFastX, scalarFastY, batchFastX, batchFastY);
+
+	printf("normalize timing    vectors=%u x %d\n", VECTOR_NUM, REPEAT_NUM);
+	printf("    scalar exact %8.3f ms  fast %8.3f ms  speedup %5.2fx\n",
+		scalarExactMs, scalarFastMs, scalarExactMs / scalarFastMs);
+	printf("    batch  exact %8.3f ms  fast %8.3f ms  speedup %5.2fx  (vs scalar exact %5.2fx)\n",
+		batchExactMs, batchFastMs, batchExactMs / batchFastMs, scalarExactMs / batchFastMs);
+	printf("    batch mismatches  exact %u  fast %u\n", exactMismatch, fastMismatch);
+
+	bool ok = withinBound && exactMismatch == 0 && fastMismatch == 0;
+	printf(ok ? "fast normalize is within its bound and the batches match the scalar functions\n"
+			  : "fast normalize is out of its bound or the batches differ from the scalar functions\n");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+/******************************************************************************/
+/*!
+\file		Affine2D.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares and defines the functions for
+			Affine2D, a 2x3
+			matrix holding the first two rows of an affine Matrix3x3 (the
+			last row is always 0 0 1). Like Vector2D.h, it is header only.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#pragma once
+
+#include "Matrix3x3.h"
+
+namespace CSD1130
+{
+	#ifdef _MSC_VER
+	// Supress warning: nonstandard extension used : nameless struct/union
+	#pragma warning( disable : 4201 )
+	#endif
+
+	/**************************************************************************/
+	/*!
+
+	 */
+	/**************************************************************************/
+	typedef union Affine2D
+	{
+		struct
+		{
+			float m00, m01, m02;
+			float m10, m11, m12;
+		};
+
+		float m[6];
+		float m2[2][3];
+
+		constexpr Affine2D() : m00(0.0f), m01(0.0f), m02(0.0f), m10(0.0f), m11(0.0f), m12(0.0f) {}
+		constexpr Affine2D(float _00, float _01, float _02,
+						   float _10, float _11, float _12) :
+			m00(_00), m01(_01), m02(_02),
+			m10(_10), m11(_11), m12(_12) {}
+
+		Affine2D& operator=(const Affine2D &rhs) = default;
+		Affine2D(const Affine2D& rhs) = default;
+
+		// Assignment operators
+		CSD1130_INLINE constexpr Affine2D& operator *= (const Affine2D &rhs);
+
+	} Affine2D, Aff2D;
+
+	#ifdef _MSC_VER
+	// Supress warning: nonstandard extension used : nameless struct/union
+	#pragma warning( default : 4201 )
+	#endif
+
+	/**************************************************************************/
+	/*!
+		This operator composes lhs with rhs: the result applies rhs first,
+		then lhs
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr Affine2D operator * (const Affine2D &lhs, const Affine2D &rhs) {
+		// the missing row of both is 0 0 1
+		return Affine2D(
+			lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10,
+			lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11,
+			lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02,
+			lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10,
+			lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11,
+			lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12);
+	}
+
+	CSD1130_INLINE constexpr Affine2D& Affine2D::operator *= (const Affine2D &rhs) {
+		*this = *this * rhs;
+		return *this;
+	}
+
+	/**************************************************************************/
+	/*!
+		This operator transforms the point rhs by pMtx and returns the
+		result as a vector
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr Vector2D operator * (const Affine2D &pMtx, const Vector2D &rhs) {
+		return Vector2D(pMtx.m00 * rhs.x + pMtx.m01 * rhs.y + pMtx.m02,
+						pMtx.m10 * rhs.x + pMtx.m11 * rhs.y + pMtx.m12);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function sets the matrix pResult to the identity matrix
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr void Aff2DIdentity(Affine2D &pResult) {
+		pResult = Affine2D(1.0f, 0.0f, 0.0f,
+						   0.0f, 1.0f, 0.0f);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function creates a translation matrix from x & y
+		and saves it in pResult
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr void Aff2DTranslate(Affine2D &pResult, float x, float y) {
+		pResult = Affine2D(1.0f, 0.0f, x,
+						   0.0f, 1.0f, y);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function creates a scaling matrix from x & y
+		and saves it in pResult
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr void Aff2DScale(Affine2D &pResult, float x, float y) {
+		pResult = Affine2D(x, 0.0f, 0.0f,
+						   0.0f, y, 0.0f);
+	}
+
+	/**************************************************************************/
+	/*!
+		This matrix creates a rotation matrix from "angle" whose value
+		is in radian. Save the resultant matrix in pResult.
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE void Aff2DRotRad(Affine2D &pResult, float angle) {
+		float c = cosf(angle), s = sinf(angle);
+		pResult = Affine2D(c, -s, 0.0f,
+						   s, c, 0.0f);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function creates the matrix Translate(x, y) * Scale(scaleX,
+		scaleY) * RotRad(angle), written out instead of multiplied, and
+		saves it in pResult
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE void Aff2DCompose(Affine2D &pResult, float x, float y, float scaleX, float scaleY, float angle) {
+		float c = cosf(angle), s = sinf(angle);
+
+		// the scale multiplies the rows of the rotation, the translation
+		// only fills the last column
+		pResult = Affine2D(scaleX * c, -(scaleX * s), x,
+						   scaleY * s, scaleY * c, y);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function calculates the inverse matrix of pMtx and saves the
+		result in pResult, and its determinant in determinant. Returns
+		false, leaving pResult unchanged, if pMtx cannot be inverted.
+	*/
+	/**************************************************************************/
+	CSD1130_INLINE constexpr bool Aff2DInverse(Affine2D &pResult, float *determinant, const Affine2D &pMtx) {
+		float det = pMtx.m00 * pMtx.m11 - pMtx.m01 * pMtx.m10;
+
+		if (det == 0) {
+			// The matrix is singular, cannot be inverted
+			return false;
+		}
+
+		if (determinant)
+			*determinant = det;
+
+		float invDet = 1.0f / det;
+
+		// inverse of the linear part, then the translation undone by it
+		float a = pMtx.m11 * invDet, b = -pMtx.m01 * invDet,
+			c = -pMtx.m10 * invDet, d = pMtx.m00 * invDet;
+
+		pResult = Affine2D(a, b, -(a * pMtx.m02 + b * pMtx.m12),
+						   c, d, -(c * pMtx.m02 + d * pMtx.m12));
+		return true;
+	}
+
+	/**************************************************************************/
+	/*!
+		This function transforms the point pt (rotation, scale and
+		translation)
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr Vector2D Aff2DTransformPoint(const Affine2D &pMtx, const Vector2D &pt) {
+		return pMtx * pt;
+	}
+
+	/**************************************************************************/
+	/*!
+		This function transforms the vector vec (rotation and scale only)
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr Vector2D Aff2DTransformVector(const Affine2D &pMtx, const Vector2D &vec) {
+		return Vector2D(pMtx.m00 * vec.x + pMtx.m01 * vec.y,
+						pMtx.m10 * vec.x + pMtx.m11 * vec.y);
+	}
+
+	/**************************************************************************/
+	/*!
+		This function transforms the count points of pSrc and saves them
+		in pDst. pDst may be pSrc.
+	 */
+	/**************************************************************************/
+	inline void Aff2DTransformPoints(const Affine2D &pMtx, const Vector2D *pSrc, Vector2D *pDst, unsigned int count) {
+		// copies of the matrix let the compiler keep it in registers
+		float m00 = pMtx.m00, m01 = pMtx.m01, m02 = pMtx.m02,
+			m10 = pMtx.m10, m11 = pMtx.m11, m12 = pMtx.m12;
+
+		for (unsigned int i = 0; i < count; ++i) {
+			float x = pSrc[i].x, y = pSrc[i].y;
+			pDst[i].x = m00 * x + m01 * y + m02;
+			pDst[i].y = m10 * x + m11 * y + m12;
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		This function transforms the count vectors of pSrc and saves them
+		in pDst. pDst may be pSrc.
+	 */
+	/**************************************************************************/
+	inline void Aff2DTransformVectors(const Affine2D &pMtx, const Vector2D *pSrc, Vector2D *pDst, unsigned int count) {
+		float m00 = pMtx.m00, m01 = pMtx.m01,
+			m10 = pMtx.m10, m11 = pMtx.m11;
+
+		for (unsigned int i = 0; i < count; ++i) {
+			float x = pSrc[i].x, y = pSrc[i].y;
+			pDst[i].x = m00 * x + m01 * y;
+			pDst[i].y = m10 * x + m11 * y;
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		This function saves pMtx in pResult as a 3x3 matrix, e.g. for
+		AEGfxSetTransform
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr void Aff2DToMtx33(Matrix3x3 &pResult, const Affine2D &pMtx) {
+		pResult = Matrix3x3(pMtx.m00, pMtx.m01, pMtx.m02,
+							pMtx.m10, pMtx.m11, pMtx.m12,
+							0.0f, 0.0f, 1.0f);
+	}
+}
@@ -0,0 +1,73 @@
+/******************************************************************************/
+/*!
+\file		BVH.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the static bounding volume hierarchy
+			over line segments and circles, together with StaticBVHBuild,
+			StaticBVHQuery and StaticBVHClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_BVH_H_
+#define CSD1130_BVH_H_
+
+#include "Collision.h"
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	BVHNode struct
+
+	Nodes are stored depth first: the left child of an internal node always
+	directly follows it, m_first holds the index of its right child.
+	A leaf (m_count > 0) owns m_items[m_first] .. m_items[m_first + m_count - 1].
+ */
+/******************************************************************************/
+struct BVHNode
+{
+	AABB			m_aabb;
+	unsigned int	m_first{};
+	unsigned int	m_count{};
+};
+
+/******************************************************************************/
+/*!
+*	StaticBVH struct
+ */
+/******************************************************************************/
+struct StaticBVH
+{
+	std::vector<BVHNode>		m_nodes;		// m_nodes[0] is the root
+	std::vector<unsigned int>	m_items;		// primitive indices, grouped per leaf
+};
+
+void StaticBVHBuild(StaticBVH &bvh,											//BVH reference - output
+					const AABB *pBoxes,										//Bounding box of every primitive - input
+					unsigned int boxNum);									//Number of primitives - input
+
+void StaticBVHBuild(StaticBVH &bvh,											//BVH reference - output
+					const LineSegment *pSegments,							//Static line segments - input
+					unsigned int segmentNum,								//Number of line segments - input
+					const Circle *pCircles,									//Static circles, indexed after the segments - input
+					unsigned int circleNum);								//Number of circles - input
+
+void StaticBVHQuery(const StaticBVH &bvh,									//BVH - input
+					const AABB &aabb,										//Query box - input
+					std::vector<unsigned int> &result);						//Sorted primitive indices - output
+
+void StaticBVHQuery(const StaticBVH &bvh,									//BVH - input
+					const Circle &circle,									//Circle data - input
+					const CSD1130::Vec2 &ptEnd,								//End circle position - input
+					std::vector<unsigned int> &result);						//Sorted primitive indices - output
+
+void StaticBVHClear(StaticBVH &bvh);										//BVH reference - input/output
+
+
+#endif // CSD1130_BVH_H_
@@ -0,0 +1,69 @@
+/******************************************************************************/
+/*!
+\file		BallStore.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the structure-of-arrays storage for the
+			simulated balls, together with BallStoreReserve, BallStoreAdd,
+			BallStoreRemove, BallStoreSavePositions, BallStoreRemoveAll and
+			BallStoreClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_BALL_STORE_H_
+#define CSD1130_BALL_STORE_H_
+
+#include "Vector2D.h"
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	BallStore struct
+
+	Every ball is an index into the arrays below. The arrays stay dense:
+	removing a ball moves the last ball into its slot.
+ */
+/******************************************************************************/
+struct BallStore
+{
+	std::vector<float>	m_posX;
+	std::vector<float>	m_posY;
+	std::vector<float>	m_velX;
+	std::vector<float>	m_velY;
+	std::vector<float>	m_radius;
+	std::vector<float>	m_speed;
+
+	// positions at the last BallStoreSavePositions, to draw the balls
+	// between two steps
+	std::vector<float>	m_prevPosX;
+	std::vector<float>	m_prevPosY;
+
+	unsigned int		m_count{};
+};
+
+void BallStoreReserve(	BallStore &store,									//Ball store reference - input/output
+						unsigned int capacity);								//Number of balls to make room for - input
+
+unsigned int BallStoreAdd(	BallStore &store,								//Ball store reference - input/output
+							const CSD1130::Vec2 &pos,						//Ball position - input
+							const CSD1130::Vec2 &vel,						//Ball velocity - input
+							float radius,									//Ball radius - input
+							float speed);									//Ball speed - input
+
+unsigned int BallStoreRemove(	BallStore &store,							//Ball store reference - input/output
+								unsigned int ballIdx);						//Index of the ball to remove - input
+
+void BallStoreSavePositions(	BallStore &store);							//Ball store reference - input/output
+
+void BallStoreRemoveAll(	BallStore &store);								//Ball store reference - input/output
+
+void BallStoreClear(	BallStore &store);									//Ball store reference - input/output
+
+
+#endif // CSD1130_BALL_STORE_H_
@@ -0,0 +1,117 @@
+/******************************************************************************/
+/*!
+\file		CageReplay.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the record and replay log of a Cage
+			run, together with CageReplayBegin, CageReplayRecord,
+			CageReplayWrite, CageReplayRead, CageReplayNext,
+			CageReplayLevel and CageReplayClear.
+
+			The simulation only depends on the level, the settings it was
+			started with and the time of each frame, which CageSimAdvance
+			turns into fixed steps. A log keeps those, and the keys that
+			change the run (R restarts, F toggles full screen), so that
+			replaying it steps the balls bit-identically, in the game or in
+			CageHeadless as fast as the CPU allows.
+
+			File layout: a CageReplayHeader, the compiled level (as written
+			by LevelBinaryWrite), the time of each frame as float, then the
+			keys of each frame as one byte. A level compiled by another
+			build is rejected when the log is read, like a compiled level
+			file would be, and so is a log recorded by a build that
+			normalizes vectors another way (CSD1130_FAST_NORMALIZE), which
+			moves the balls differently.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_CAGE_REPLAY_H_
+#define CSD1130_CAGE_REPLAY_H_
+
+#include "LevelBinary.h"
+#include <vector>
+
+
+const unsigned int	CAGE_REPLAY_MAGIC			= 0x4C504552;	// "REPL"
+const unsigned int	CAGE_REPLAY_VERSION			= 2;
+
+// keys triggered in a frame, or-ed together
+const unsigned char	CAGE_REPLAY_KEY_RESTART		= 0x01;			// R
+const unsigned char	CAGE_REPLAY_KEY_FULLSCREEN	= 0x02;			// F
+
+/******************************************************************************/
+/*!
+*	CageReplaySettings struct
+
+	Settings the simulation was started with
+ */
+/******************************************************************************/
+struct CageReplaySettings
+{
+	int				m_broadphase{};			// 0: uniform grid, 1: BVH
+	int				m_collision{};			// 0: walls in index order, 1: continuous, 2: event driven
+	int				m_checkLineEdges{};		// 1: collide with the line segment edges
+	int				m_ballCollision{};		// 1: collide balls with each other
+	float			m_stepDt{};				// fixed time step
+	int				m_stepMax{};			// most steps in one frame
+};
+
+/******************************************************************************/
+/*!
+*	CageReplayHeader struct
+ */
+/******************************************************************************/
+struct CageReplayHeader
+{
+	unsigned int		m_magic;
+	unsigned int		m_version;
+	unsigned int		m_fastNormalize;	// CSD1130_FAST_NORMALIZE of the recording build
+	CageReplaySettings	m_settings;
+	unsigned int		m_levelSize;		// bytes of compiled level after the header
+	unsigned int		m_frameNum;
+};
+
+/******************************************************************************/
+/*!
+*	CageReplay struct
+ */
+/******************************************************************************/
+struct CageReplay
+{
+	CageReplaySettings			m_settings;
+	std::vector<unsigned char>	m_level;		// compiled level the run started with
+	std::vector<float>			m_frameDt;		// time of each frame
+	std::vector<unsigned char>	m_frameKeys;	// CAGE_REPLAY_KEY_* of each frame
+	size_t						m_frameIdx{};	// next frame CageReplayNext returns
+};
+
+void CageReplayBegin(	CageReplay &replay,									//Replay reference - output
+						const CageReplaySettings &settings,					//Simulation settings - input
+						const LevelBinary &level);							//Level the run starts with - input
+
+void CageReplayRecord(	CageReplay &replay,									//Replay reference - input/output
+						float frameDt,										//Frame time - input
+						unsigned char keys);								//CAGE_REPLAY_KEY_* triggered in the frame - input
+
+bool CageReplayWrite(	const CageReplay &replay,							//Replay - input
+						const char *pFileName);								//Path of the log to write - input
+
+bool CageReplayRead(	CageReplay &replay,									//Replay reference - output
+						const char *pFileName);								//Path of the log to read - input
+
+bool CageReplayNext(	CageReplay &replay,									//Replay reference - input/output
+						float &frameDt,										//Frame time - output
+						unsigned char &keys);								//CAGE_REPLAY_KEY_* triggered in the frame - output
+
+bool CageReplayLevel(	const CageReplay &replay,							//Replay - input
+						LevelBinary &level);								//Level the run started with - output
+
+void CageReplayClear(	CageReplay &replay);								//Replay reference - input/output
+
+
+#endif // CSD1130_CAGE_REPLAY_H_
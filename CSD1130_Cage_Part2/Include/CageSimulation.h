@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*!
+\file		CageSimulation.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the ball/wall simulation of the Cage
+			state, independent of AlphaEngine, together with CageSimInit,
+			CageSimRestart, CageSimRemoveBall, CageSimStep, CageSimAdvance,
+			CageSimWallCandidates, CageSimWallTestNum, CageSimBallTestNum
+			and CageSimClear.
+
+			CageSimAdvance turns frame times into fixed steps, so that the
+			game and a replay of its frame times (CageReplay.h) step the
+			balls exactly the same way.
+
+			Pillars are static circles. They share the broadphase of the
+			walls and are told apart by their index: walls come first,
+			pillar i is obstacle m_wallNum + i.
+
+			Balls only read the walls and write their own data during a
+			step, so CageSimStep can split them over the workers of a
+			JobSystem and still give the same result as on one thread.
+
+			With continuous collision, a ball moves to the earliest impact
+			among the walls on its path, reflects there, and goes on with
+			the rest of its step, up to CAGE_SIM_BOUNCE_MAX times. Otherwise
+			the walls are checked in index order and each one reflects the
+			path left by the previous ones, which can pick a later impact
+			first and let fast balls through corners.
+
+			In the event driven mode, each ball knows the time of its next
+			wall impact, computed once after each bounce, and the balls are
+			only tested against the walls when an impact of the event queue
+			is due. In between, their position is extrapolated from the last
+			impact. Paths are looked ahead CAGE_SIM_EVENT_HORIZON seconds at
+			a time, a ball that hits nothing in that time is checked again
+			at its end.
+
+			Balls collide with each other after the walls, on the calling
+			thread, with the pairs found by a SweepAndPrune kept from one
+			step to the next. The event driven mode has no ball-vs-ball
+			collision: a bounce between balls would change the impacts
+			already queued.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_CAGE_SIMULATION_H_
+#define CSD1130_CAGE_SIMULATION_H_
+
+#include "BallStore.h"
+#include "BVH.h"
+#include "Collision.h"
+#include "JobSystem.h"
+#include "LevelBinary.h"
+#include "SpatialGrid.h"
+#include "SweepAndPrune.h"
+#include <functional>
+#include <queue>
+#include <vector>
+
+const unsigned int	CAGE_SIM_BOUNCE_MAX		= 8;	//Walls a ball can hit in one step with continuous collision
+const float			CAGE_SIM_EVENT_HORIZON	= 1.0f;	//Seconds a ball's path is checked ahead in the event driven mode
+
+
+/******************************************************************************/
+/*!
+*	CageSimEvent struct
+
+	Next wall impact of a ball in the event driven mode
+ */
+/******************************************************************************/
+struct CageSimEvent
+{
+	double			m_time;									// simulation time of the impact
+	unsigned int	m_ballIdx;
+
+	// earliest first, ties by ball so that the order never depends on the queue
+	bool operator > (const CageSimEvent &rhs) const
+	{
+		return m_time > rhs.m_time || (m_time == rhs.m_time && m_ballIdx > rhs.m_ballIdx);
+	}
+};
+
+
+/******************************************************************************/
+/*!
+*	CageSimulation struct
+ */
+/******************************************************************************/
+struct CageSimulation
+{
+	BallStore					m_balls;
+	const LineSegment			*m_pWalls{};				// used in place from the LevelBinary
+	unsigned int				m_wallNum{};
+	const Circle				*m_pPillars{};			// used in place from the LevelBinary
+	unsigned int				m_pillarNum{};
+	unsigned int				m_obstacleNum{};		// m_wallNum + m_pillarNum, also means no obstacle
+
+	int							m_broadphase{};			// 0: uniform grid, 1: BVH
+	int							m_collision{};			// 0: walls in index order, 1: earliest time of impact first, 2: event driven
+	bool						m_checkLineEdges{};		// collide with the line segment edges (Extra Credits)
+	bool						m_ballCollision{};		// collide balls with each other
+
+	// broadphase over m_pWalls and m_pPillars, built once they are loaded
+	SpatialGrid					m_wallGrid;
+	StaticBVH					m_wallBVH;
+
+	// broadphase over the balls, sorted again at each step, and the
+	// pairs it found, two indices per pair
+	SweepAndPrune				m_ballSAP;
+	std::vector<unsigned int>	m_ballPairs;
+	unsigned long long			m_ballTestNum{};		// ball-vs-ball tests since CageSimInit
+
+	// scratch buffers of CageSimStep: ball positions at the end of the
+	// step before collision, and wall candidates, one buffer per worker
+	std::vector<float>						m_posNextX;
+	std::vector<float>						m_posNextY;
+	std::vector<std::vector<unsigned int>>	m_wallCandidates;
+
+	// ball-vs-wall tests made by each worker since CageSimInit
+	std::vector<unsigned long long>			m_wallTestNum;
+
+	// event driven mode: time since CageSimInit, per ball the position and
+	// time of the last impact, the wall it hit, the time of the next impact
+	// and the wall it will hit then (m_obstacleNum: none) with the normal
+	// there, and the queue of next impacts, one per ball
+	double									m_time{};
+	std::vector<float>						m_eventPosX;
+	std::vector<float>						m_eventPosY;
+	std::vector<double>						m_eventTime;
+	std::vector<unsigned int>				m_eventLastWall;
+	std::vector<double>						m_eventNextTime;
+	std::vector<unsigned int>				m_eventNextWall;
+	std::vector<float>						m_eventNormalX;
+	std::vector<float>						m_eventNormalY;
+	std::priority_queue<CageSimEvent, std::vector<CageSimEvent>, std::greater<CageSimEvent>>	m_events;
+
+	// frame time CageSimAdvance has not simulated yet, less than one step
+	double									m_frameTimeLeft{};
+};
+
+void CageSimInit(	CageSimulation &sim,									//Simulation reference - output
+					const LevelBinary &level,								//Compiled level, must outlive sim - input
+					int broadphase,											//0: uniform grid, 1: BVH - input
+					int collision,											//0: walls in index order, 1: continuous, 2: event driven - input
+					bool checkLineEdges,									//When true => collide with line segment edges - input
+					bool ballCollision);									//When true => collide balls with each other - input
+
+void CageSimRestart(	CageSimulation &sim,								//Simulation reference, set by CageSimInit - input/output
+						const LevelBinary &level);							//Compiled level sim was set with - input
+
+unsigned int CageSimRemoveBall(	CageSimulation &sim,						//Simulation reference - input/output
+								unsigned int ballIdx);						//Index of the ball to remove - input
+
+void CageSimStep(	CageSimulation &sim,									//Simulation reference - input/output
+					float dt,												//Time step - input
+					JobSystem *pJobs);										//Workers to split the balls over, NULL => calling thread only - input
+
+unsigned int CageSimAdvance(	CageSimulation &sim,						//Simulation reference - input/output
+								float frameDt,								//Frame time - input
+								float stepDt,								//Fixed time step - input
+								unsigned int stepMax,						//Most steps for this frame - input
+								JobSystem *pJobs);							//Workers to split the balls over, NULL => calling thread only - input
+
+void CageSimWallCandidates(	const CageSimulation &sim,						//Simulation - input
+							const Circle &ball,								//Ball data at the start of the step - input
+							const CSD1130::Vec2 &ptEnd,						//End ball position - input
+							std::vector<unsigned int> &result);				//Sorted wall indices - output
+
+unsigned long long CageSimWallTestNum(	const CageSimulation &sim);			//Simulation - input
+
+unsigned long long CageSimBallTestNum(	const CageSimulation &sim);			//Simulation - input
+
+void CageSimClear(	CageSimulation &sim);									//Simulation reference - input/output
+
+
+#endif // CSD1130_CAGE_SIMULATION_H_
@@ -5,9 +5,12 @@
 \par    	email: yiming.guo@digipen.edu
 \date   	Mar 18, 2023
 \brief		This source file contains definitions for BuildLineSegment,
+			BuildAABB, AABBOverlap,
 			CollisionIntersection_CircleLineSegment,
-			CheckMovingCircleToLineEdge and
-			CollisionResponse_CircleLineSegment.
+			CheckMovingCircleToLineEdge, CollisionIntersection_CircleCircle,
+			CollisionIntersection_MovingCircleCircle,
+			CollisionResponse_CircleLineSegment and
+			CollisionResponse_CircleCircle.
 
 Copyright (C) 2023 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -18,10 +21,14 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #ifndef CSD1130_COLLISION_H_
 #define CSD1130_COLLISION_H_
 
+#include "Vector2D.h"
 
 /******************************************************************************/
 /*!
 *	LineSegment struct
+
+	Besides its end points and normal, a segment keeps the constants the
+	collision tests use for every ball, computed once by BuildLineSegment.
  */
 /******************************************************************************/
 struct LineSegment
@@ -29,6 +36,11 @@ struct LineSegment
 	CSD1130::Vec2	m_pt0;
 	CSD1130::Vec2	m_pt1;
 	CSD1130::Vec2	m_normal;
+
+	CSD1130::Vec2	m_dir;					// unit vector from m_pt0 to m_pt1
+	float			m_length{};
+	float			m_invLength{};			// 0 for a segment of length 0
+	float			m_NP0{};				// m_normal . m_pt0
 };
 
 void BuildLineSegment(	LineSegment &lineSegment,							//Line segment reference - input
@@ -46,6 +58,30 @@ struct Circle
 	float			m_radius{};
 };
 
+/******************************************************************************/
+/*!
+*	AABB struct
+ */
+/******************************************************************************/
+struct AABB
+{
+	CSD1130::Vec2	m_min;
+	CSD1130::Vec2	m_max;
+};
+
+void BuildAABB(	AABB &aabb,													//AABB reference - output
+				const LineSegment &lineSeg);								//Line segment - input
+
+void BuildAABB(	AABB &aabb,													//AABB reference - output
+				const Circle &circle);										//Circle data - input
+
+void BuildAABB(	AABB &aabb,													//AABB reference - output
+				const Circle &circle,										//Circle data at start position - input
+				const CSD1130::Vec2 &ptEnd);								//End circle position - input
+
+bool AABBOverlap(const AABB &aabb0,											//First box - input
+				 const AABB &aabb1);										//Second box - input
+
 
 // INTERSECTION FUNCTIONS
 int CollisionIntersection_CircleLineSegment(const Circle &circle,			//Circle data - input
@@ -68,6 +104,18 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,						//Flag stating that t
 	float &interTime);														//Intersection time ti - output
 
 
+bool CollisionIntersection_CircleCircle(const Circle &circle0,				//First circle - input
+	const Circle &circle1,													//Second circle - input
+	CSD1130::Vec2 &normal);													//Unit vector from circle0 to circle1 - output
+
+int CollisionIntersection_MovingCircleCircle(const Circle &circle,			//Circle data - input
+	const CSD1130::Vec2 &ptEnd,												//End circle position - input
+	const Circle &staticCircle,												//Circle that does not move - input
+	CSD1130::Vec2 &interPt,													//Intersection point - output
+	CSD1130::Vec2 &normalAtCollision,										//Normal vector at collision time - output
+	float &interTime);														//Intersection time ti - output
+
+
 
 // RESPONSE FUNCTIONS
 void CollisionResponse_CircleLineSegment(const CSD1130::Vec2 &ptInter,		//Intersection position of the circle - input
@@ -75,6 +123,10 @@ void CollisionResponse_CircleLineSegment(const CSD1130::Vec2 &ptInter,		//Inters
 	CSD1130::Vec2 &ptEnd,													//Final position of the circle after reflection - output
 	CSD1130::Vec2 &reflected);												//Normalized reflection vector direction - output
 
+void CollisionResponse_CircleCircle(const CSD1130::Vec2 &normal,			//Unit vector from circle 0 to circle 1 - input
+	CSD1130::Vec2 &vel0,													//Velocity of circle 0 - input/output
+	CSD1130::Vec2 &vel1);													//Velocity of circle 1 - input/output
+
 
 
 
@@ -0,0 +1,132 @@
+/******************************************************************************/
+/*!
+\file		CollisionBatch.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the batched (SIMD) counterparts of
+			CollisionIntersection_CircleLineSegment:
+			CollisionIntersectionBatch_CirclesLineSegment and
+			CollisionIntersectionBatch_CircleLineSegments.
+
+			Both evaluate every branch of the scalar test (LNS1, LNS2 and,
+			when checkLineEdges is set, the line edges) in SSE2 lanes, or
+			AVX lanes when the file is compiled with AVX enabled, and select
+			the result per lane with masks. The operations are the ones of the
+			scalar code in the same order, so the results are bit-identical
+			as long as neither side is compiled with floating point
+			contraction into FMA (the MSVC /fp:precise default, GCC without
+			-mfma or with -ffp-contract=off). With contraction enabled the
+			outputs only agree up to round-off (CollisionBatchBenchmark sees
+			differences below 1e-2 world units) and hit flags may differ for
+			grazing contacts.
+
+			Vector2DNormalizeBatchExact/Fast are the lane-wise counterparts
+			of CSD1130::Vector2DNormalizeExact/Fast, under the same terms,
+			and Vector2DNormalizeBatch follows CSD1130_FAST_NORMALIZE like
+			CSD1130::Vector2DNormalize does.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_COLLISION_BATCH_H_
+#define CSD1130_COLLISION_BATCH_H_
+
+#include "Collision.h"
+
+
+/******************************************************************************/
+/*!
+*	CircleBatch struct
+
+	Moving circles stored as structure of arrays, e.g. the arrays of a
+	BallStore with the end positions of this frame.
+ */
+/******************************************************************************/
+struct CircleBatch
+{
+	const float		*pStartX;
+	const float		*pStartY;
+	const float		*pEndX;
+	const float		*pEndY;
+	const float		*pRadius;
+};
+
+/******************************************************************************/
+/*!
+*	SegmentBatch struct
+
+	Line segments stored as structure of arrays.
+ */
+/******************************************************************************/
+struct SegmentBatch
+{
+	const float		*pPt0X;
+	const float		*pPt0Y;
+	const float		*pPt1X;
+	const float		*pPt1Y;
+	const float		*pNormalX;
+	const float		*pNormalY;
+	const float		*pDirX;					// LineSegment::m_dir
+	const float		*pDirY;
+	const float		*pLength;				// LineSegment::m_length
+	const float		*pNP0;					// LineSegment::m_NP0
+};
+
+/******************************************************************************/
+/*!
+*	CollisionBatchResult struct
+
+	One entry per tested pair. Entries of pairs that do not collide are
+	set to 0.
+ */
+/******************************************************************************/
+struct CollisionBatchResult
+{
+	int				*pHit;					// 1 if the pair collides, else 0
+	float			*pInterTime;
+	float			*pInterPtX;
+	float			*pInterPtY;
+	float			*pNormalX;
+	float			*pNormalY;
+};
+
+
+// N moving circles against one line segment, returns the number of hits
+unsigned int CollisionIntersectionBatch_CirclesLineSegment(const CircleBatch &circles,	//Circles data - input
+	unsigned int circleNum,													//Number of circles - input
+	const LineSegment &lineSeg,												//Line segment - input
+	CollisionBatchResult &result,											//Per circle result - output
+	bool checkLineEdges);													//When true => check collision with line segment edges
+
+// One moving circle against N line segments, returns the number of hits
+unsigned int CollisionIntersectionBatch_CircleLineSegments(const Circle &circle,	//Circle data - input
+	const CSD1130::Vec2 &ptEnd,												//End circle position - input
+	const SegmentBatch &lineSegs,											//Line segments - input
+	unsigned int lineSegNum,												//Number of line segments - input
+	CollisionBatchResult &result,											//Per segment result - output
+	bool checkLineEdges);													//When true => check collision with line segment edges
+
+// Normalizes N vectors stored as structure of arrays in place
+void Vector2DNormalizeBatchExact(float *pX,									//Vectors x - input/output
+	float *pY,																//Vectors y - input/output
+	unsigned int count);													//Number of vectors - input
+
+void Vector2DNormalizeBatchFast(float *pX,									//Vectors x - input/output
+	float *pY,																//Vectors y - input/output
+	unsigned int count);													//Number of vectors - input
+
+inline void Vector2DNormalizeBatch(float *pX, float *pY, unsigned int count)
+{
+#if CSD1130_FAST_NORMALIZE
+	Vector2DNormalizeBatchFast(pX, pY, count);
+#else
+	Vector2DNormalizeBatchExact(pX, pY, count);
+#endif
+}
+
+
+#endif // CSD1130_COLLISION_BATCH_H_
@@ -0,0 +1,97 @@
+/******************************************************************************/
+/*!
+\file		JobSystem.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares a small work-stealing thread pool
+			together with JobSystemInit, JobSystemParallelFor,
+			JobSystemWorkerNum and JobSystemShutdown.
+
+			JobSystemParallelFor splits a range into chunks and deals them
+			out to one queue per worker. A worker takes chunks from the back
+			of its own queue and, once it is empty, steals from the front of
+			the others, so uneven chunks (e.g. balls hitting many walls) are
+			balanced out. The calling thread works as worker 0 and returns
+			once every chunk is done.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_JOB_SYSTEM_H_
+#define CSD1130_JOB_SYSTEM_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Runs the items [begin, end) of a range, on the worker workerIdx
+typedef void (*JobFunc)(void *pUserData, unsigned int begin, unsigned int end, unsigned int workerIdx);
+
+/******************************************************************************/
+/*!
+*	Job struct
+ */
+/******************************************************************************/
+struct Job
+{
+	JobFunc			m_pFunc;
+	void			*m_pUserData;
+	unsigned int	m_begin;
+	unsigned int	m_end;
+};
+
+/******************************************************************************/
+/*!
+*	JobQueue struct
+ */
+/******************************************************************************/
+struct JobQueue
+{
+	std::mutex			m_mutex;
+	std::deque<Job>		m_jobs;
+};
+
+/******************************************************************************/
+/*!
+*	JobSystem struct
+ */
+/******************************************************************************/
+struct JobSystem
+{
+	std::vector<std::thread>		m_threads;			// workers 1..N-1, worker 0 is the caller
+	std::unique_ptr<JobQueue[]>		m_queues;			// one per worker
+	unsigned int					m_workerNum{};
+
+	std::atomic<unsigned int>		m_queued{};			// jobs in the queues
+	std::atomic<unsigned int>		m_pending{};		// jobs not finished yet
+
+	std::mutex						m_wakeMutex;
+	std::condition_variable			m_wake;
+	bool							m_quit{};
+};
+
+void JobSystemInit(	JobSystem &jobs,											//Job system reference - output
+					unsigned int workerNum);									//Number of workers including the caller, 0 => one per hardware thread - input
+
+void JobSystemParallelFor(	JobSystem &jobs,									//Job system reference - input/output
+							unsigned int begin,									//First item of the range - input
+							unsigned int end,									//One past the last item of the range - input
+							unsigned int chunkSize,								//Number of items per job - input
+							JobFunc pFunc,										//Function running a chunk - input
+							void *pUserData);									//Data passed to pFunc - input
+
+unsigned int JobSystemWorkerNum(	const JobSystem &jobs);						//Job system - input
+
+void JobSystemShutdown(	JobSystem &jobs);										//Job system reference - input/output
+
+
+#endif // CSD1130_JOB_SYSTEM_H_
@@ -0,0 +1,92 @@
+/******************************************************************************/
+/*!
+\file		LevelArena.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the linear allocator holding the data
+			that lives as long as a level, together with LevelArenaInit,
+			LevelArenaAlloc, LevelArenaAllocArray, LevelArenaKeep,
+			LevelArenaReset and LevelArenaRelease.
+
+			Allocations are taken one after the other from large blocks and
+			are never freed one by one: LevelArenaReset drops everything
+			allocated since LevelArenaKeep at once, LevelArenaRelease gives
+			the blocks back. A reset keeps the blocks, and merges the ones
+			after the kept allocations into a single block, so that the
+			next run of the level allocates nothing and finds its data in
+			one piece.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_LEVEL_ARENA_H_
+#define CSD1130_LEVEL_ARENA_H_
+
+#include <cstddef>
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	LevelArenaBlock struct
+ */
+/******************************************************************************/
+struct LevelArenaBlock
+{
+	unsigned char	*m_pData;
+	size_t			m_size;
+};
+
+/******************************************************************************/
+/*!
+*	LevelArena struct
+ */
+/******************************************************************************/
+struct LevelArena
+{
+	std::vector<LevelArenaBlock>	m_blocks;			// filled in order
+	size_t							m_blockIdx{};		// block allocated from, m_blocks.size() when none is left
+	size_t							m_used{};			// bytes taken from m_blocks[m_blockIdx]
+	size_t							m_keepBlockIdx{};	// m_blockIdx and m_used at LevelArenaKeep
+	size_t							m_keepUsed{};
+	size_t							m_blockSize{};		// least size of a new block
+};
+
+void LevelArenaInit(	LevelArena &arena,									//Arena reference - output
+						size_t blockSize);									//Least size of a block in bytes - input
+
+void *LevelArenaAlloc(	LevelArena &arena,									//Arena reference - input/output
+						size_t size,										//Size in bytes - input
+						size_t align);										//Alignment, a power of 2 up to alignof(std::max_align_t) - input
+
+void LevelArenaKeep(	LevelArena &arena);									//Arena reference - input/output
+
+void LevelArenaReset(	LevelArena &arena);									//Arena reference - input/output
+
+void LevelArenaRelease(	LevelArena &arena);									//Arena reference - input/output
+
+/******************************************************************************/
+/*!
+* \brief Allocates count zeroed objects of type T from the arena. Their
+		 destructor is never called, so T must not need one.
+*
+* \param [in,out]	arena		Reference to the LevelArena.
+*
+* \param [in]		count		Number of objects.
+*
+  \return			T *			Pointer to the first object, NULL when the
+								memory ran out.
+ */
+/******************************************************************************/
+template <typename T>
+T *LevelArenaAllocArray(LevelArena &arena, size_t count)
+{
+	return (T *)LevelArenaAlloc(arena, count * sizeof(T), alignof(T));
+}
+
+
+#endif // CSD1130_LEVEL_ARENA_H_
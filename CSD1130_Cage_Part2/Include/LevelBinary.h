@@ -0,0 +1,130 @@
+/******************************************************************************/
+/*!
+\file		LevelBinary.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the compiled (binary) level format
+			together with LevelBinaryBuild, LevelBinaryWrite,
+			LevelBinaryOpen, LevelBinaryLoad and LevelBinaryClose.
+
+			A compiled level holds everything GameStateCageInit used to
+			compute from the text file, laid out as arrays that are used in
+			place once the file is memory-mapped:
+			- a LevelBinaryHeader
+			- the balls as Circle, their velocity and their speed
+			- the walls as LineSegment (normals and collision constants
+			  included) and the position, scale and angle they are drawn
+			  with
+			- the pillars as Circle
+			Every array starts on a 16 byte boundary. The header records the
+			format version and the size of Circle and LineSegment, so a file
+			compiled by an older or different build is rejected instead of
+			misread; the file is then rebuilt with LevelCompiler. It also
+			records the hash of the text file it was compiled from, so that
+			a compiled level older than its text file can be told apart.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_LEVEL_BINARY_H_
+#define CSD1130_LEVEL_BINARY_H_
+
+#include "Collision.h"
+#include "LevelData.h"
+#include <cstddef>
+#include <vector>
+
+
+const unsigned int	LEVEL_BINARY_MAGIC		= 0x45474143;	// "CAGE"
+const unsigned int	LEVEL_BINARY_VERSION	= 4;
+
+/******************************************************************************/
+/*!
+*	LevelBinaryHeader struct
+ */
+/******************************************************************************/
+struct LevelBinaryHeader
+{
+	unsigned int	m_magic;
+	unsigned int	m_version;
+	unsigned int	m_size;					// of the whole file, header included
+	unsigned int	m_circleSize;			// sizeof(Circle) of the compiling build
+	unsigned int	m_lineSegmentSize;		// sizeof(LineSegment) of the compiling build
+
+	unsigned int	m_ballNum;
+	unsigned int	m_wallNum;
+	unsigned int	m_pillarNum;
+
+	// byte offsets of the arrays from the start of the file
+	unsigned int	m_ballOffset;
+	unsigned int	m_ballVelOffset;
+	unsigned int	m_ballSpeedOffset;
+	unsigned int	m_wallOffset;
+	unsigned int	m_wallDrawOffset;
+	unsigned int	m_pillarOffset;
+
+	unsigned long long	m_sourceHash;		// LevelDataHashFile of the text file compiled, 0 if none
+};
+
+/******************************************************************************/
+/*!
+*	LevelWallDraw struct
+
+	Transform of the wall mesh (a unit line along x) drawing a wall.
+ */
+/******************************************************************************/
+struct LevelWallDraw
+{
+	CSD1130::Vec2	m_pos;
+	float			m_scale{};
+	float			m_angle{};				// in radian
+};
+
+/******************************************************************************/
+/*!
+*	LevelBinary struct
+
+	Views into a compiled level, which is either memory-mapped from a file
+	or built in memory from a LevelData.
+ */
+/******************************************************************************/
+struct LevelBinary
+{
+	const LevelBinaryHeader		*m_pHeader{};
+	const Circle				*m_pBalls{};
+	const CSD1130::Vec2			*m_pBallVel{};
+	const float					*m_pBallSpeed{};
+	const LineSegment			*m_pWalls{};
+	const LevelWallDraw			*m_pWallDraw{};
+	const Circle				*m_pPillars{};
+	unsigned int				m_ballNum{};
+	unsigned int				m_wallNum{};
+	unsigned int				m_pillarNum{};
+
+	// storage of the views
+	void						*m_pMapping{};
+	size_t						m_mappingSize{};
+	std::vector<unsigned char>	m_blob;
+};
+
+bool LevelBinaryBuild(	LevelBinary &level,									//Compiled level reference - output
+						const LevelData &levelData);						//Level read from a text file - input
+
+bool LevelBinaryWrite(	const LevelBinary &level,							//Compiled level - input
+						const char *pFileName);								//Path of the file to write - input
+
+bool LevelBinaryOpen(	LevelBinary &level,									//Compiled level reference - output
+						const char *pFileName);								//Path of the compiled level file - input
+
+bool LevelBinaryLoad(	LevelBinary &level,									//Compiled level reference - output
+						const unsigned char *pData,							//Compiled level in memory - input
+						size_t size);										//Size of the compiled level in bytes - input
+
+void LevelBinaryClose(	LevelBinary &level);								//Compiled level reference - input/output
+
+
+#endif // CSD1130_LEVEL_BINARY_H_
@@ -0,0 +1,84 @@
+/******************************************************************************/
+/*!
+\file		LevelData.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the content of a Cage level file,
+			LevelDataLoad, which reads it from the "LevelData - *.txt"
+			text format, LevelDataWrite, which writes it, and
+			LevelDataHashFile, which tells whether a level file changed
+			without reading it.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_LEVEL_DATA_H_
+#define CSD1130_LEVEL_DATA_H_
+
+#include "Vector2D.h"
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	LevelBall struct
+ */
+/******************************************************************************/
+struct LevelBall
+{
+	CSD1130::Vec2	m_pos;
+	float			m_dir{};		// in degree
+	float			m_speed{};
+	float			m_radius{};
+};
+
+/******************************************************************************/
+/*!
+*	LevelWall struct
+ */
+/******************************************************************************/
+struct LevelWall
+{
+	CSD1130::Vec2	m_pt0;
+	CSD1130::Vec2	m_pt1;
+};
+
+/******************************************************************************/
+/*!
+*	LevelPillar struct
+ */
+/******************************************************************************/
+struct LevelPillar
+{
+	CSD1130::Vec2	m_pos;
+	float			m_radius{};
+};
+
+/******************************************************************************/
+/*!
+*	LevelData struct
+ */
+/******************************************************************************/
+struct LevelData
+{
+	std::vector<LevelBall>		m_balls;
+	std::vector<LevelWall>		m_walls;
+	std::vector<LevelPillar>	m_pillars;
+	unsigned long long			m_sourceHash{};		// LevelDataHashFile of the text file read, 0 if not read from one
+};
+
+bool LevelDataLoad(	LevelData &level,										//Level data reference - output
+					const char *pFileName);									//Path of the level text file - input
+
+bool LevelDataWrite(	const LevelData &level,								//Level data - input
+						const char *pFileName);								//Path of the level text file - input
+
+bool LevelDataHashFile(	const char *pFileName,								//Path of the level text file - input
+						unsigned long long &hash);							//Hash of its bytes - output
+
+
+#endif // CSD1130_LEVEL_DATA_H_
@@ -0,0 +1,61 @@
+/******************************************************************************/
+/*!
+\file		LevelRandom.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the settings of a randomly generated
+			stress level together with LevelRandomSizeDefault and
+			LevelRandomGenerate.
+
+			A generated level has square cages nested in each other, loose
+			walls inside them and balls spread over the whole area without
+			touching a wall or another ball. The same seed and settings
+			give the same level on every platform: the random numbers are
+			taken from the raw output of std::mt19937, which the standard
+			fixes, and not through the standard distributions, which it
+			does not. Values are rounded to the precision of the text file
+			before the checks, so a level written with LevelDataWrite and
+			read back is the one that was generated.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_LEVEL_RANDOM_H_
+#define CSD1130_LEVEL_RANDOM_H_
+
+#include "LevelData.h"
+
+
+/******************************************************************************/
+/*!
+*	LevelRandomSettings struct
+ */
+/******************************************************************************/
+struct LevelRandomSettings
+{
+	unsigned int	m_seed		= 1130;
+	unsigned int	m_ballNum	= 1000;
+	float			m_size		= 0.0f;				// half size of the outer cage, 0: LevelRandomSizeDefault
+	unsigned int	m_cageNum	= 1;				// nested cages, evenly spaced
+	unsigned int	m_sideNum	= 1;				// walls each side of a cage is split into
+	unsigned int	m_wallNum	= 0;				// loose walls inside the outer cage
+	float			m_lengthMin	= 10.0f;			// length range of the loose walls
+	float			m_lengthMax	= 80.0f;
+	bool			m_logLength	= false;			// lengths drawn log-uniformly, uniformly otherwise
+	float			m_speedMin	= 50.0f;
+	float			m_speedMax	= 400.0f;
+	float			m_radiusMin	= 2.0f;
+	float			m_radiusMax	= 10.0f;
+};
+
+float LevelRandomSizeDefault(	unsigned int ballNum);						//Number of balls - input
+
+bool LevelRandomGenerate(	LevelData &level,								//Level data reference - output
+							const LevelRandomSettings &settings);			//Generator settings - input
+
+
+#endif // CSD1130_LEVEL_RANDOM_H_
@@ -4,7 +4,8 @@
 \author 	Guo Yiming, yiming.guo, 2202613
 \par    	email: yiming.guo@digipen.edu
 \date   	Mar 18, 2023
-\brief		This header file declares the functions for Matrix3x3.
+\brief		This header file declares and defines the functions for
+			Matrix3x3. Like Vector2D.h, it is header only.
 
 Copyright (C) 2023 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -15,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #pragma once
 
 #include "Vector2D.h"
+#include <cstddef>
 
 namespace CSD1130
 {
@@ -40,18 +42,29 @@ namespace CSD1130
 		float m[9];
 		float m2[3][3];//You need this for the second part of the assignment
 
-		Matrix3x3() : m00(0.0f), m01(0.0f), m02(0.0f), m10(0.0f), m11(0.0f), m12(0.0f), m20(0.0f), m21(0.0f), m22(0.0f) {}
-		Matrix3x3(const float *pArr);
-		Matrix3x3(float _00, float _01, float _02,
-				  float _10, float _11, float _12,
-				  float _20, float _21, float _22);
-		Matrix3x3& operator=(const Matrix3x3 &rhs);
+		constexpr Matrix3x3() : m00(0.0f), m01(0.0f), m02(0.0f), m10(0.0f), m11(0.0f), m12(0.0f), m20(0.0f), m21(0.0f), m22(0.0f) {}
+		constexpr Matrix3x3(const float *pArr) :
+			m00(pArr[0]), m01(pArr[1]), m02(pArr[2]),
+			m10(pArr[3]), m11(pArr[4]), m12(pArr[5]),
+			m20(pArr[6]), m21(pArr[7]), m22(pArr[8]) {}
+		constexpr Matrix3x3(float _00, float _01, float _02,
+							float _10, float _11, float _12,
+							float _20, float _21, float _22) :
+			m00(_00), m01(_01), m02(_02),
+			m10(_10), m11(_11), m12(_12),
+			m20(_20), m21(_21), m22(_22) {}
+		CSD1130_INLINE constexpr Matrix3x3& operator=(const Matrix3x3 &rhs) {
+			m00 = rhs.m00; m01 = rhs.m01; m02 = rhs.m02;
+			m10 = rhs.m10; m11 = rhs.m11; m12 = rhs.m12;
+			m20 = rhs.m20; m21 = rhs.m21; m22 = rhs.m22;
+			return *this;
+		}
 
 		//Do not change the following
 		Matrix3x3(const Matrix3x3& rhs) = default;
 
 		// Assignment operators
-		Matrix3x3& operator *= (const Matrix3x3 &rhs);
+		CSD1130_INLINE constexpr Matrix3x3& operator *= (const Matrix3x3 &rhs);
 
 	} Matrix3x3, Mtx33;
 
@@ -60,7 +73,23 @@ namespace CSD1130
 	#pragma warning( default : 4201 )
 	#endif
 
-	Matrix3x3 operator * (const Matrix3x3 &lhs, const Matrix3x3 &rhs);
+	CSD1130_INLINE constexpr Matrix3x3 operator * (const Matrix3x3 &lhs, const Matrix3x3 &rhs) {
+		return Matrix3x3(
+			lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20,
+			lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21,
+			lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22,
+			lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20,
+			lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21,
+			lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22,
+			lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20,
+			lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21,
+			lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22);
+	}
+
+	CSD1130_INLINE constexpr Matrix3x3& Matrix3x3::operator *= (const Matrix3x3 &rhs) {
+		*this = *this * rhs;
+		return *this;
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -68,14 +97,23 @@ namespace CSD1130
 		and returns the result as a vector
 	 */
 	/**************************************************************************/
-	Vector2D  operator * (const Matrix3x3 &pMtx, const Vector2D &rhs);
+	CSD1130_INLINE constexpr Vector2D  operator * (const Matrix3x3 &pMtx, const Vector2D &rhs) {
+		float x = pMtx.m00 * rhs.x + pMtx.m01 * rhs.y + pMtx.m02;
+		float y = pMtx.m10 * rhs.x + pMtx.m11 * rhs.y + pMtx.m12;
+		float w = pMtx.m20 * rhs.x + pMtx.m21 * rhs.y + pMtx.m22;
+		return Vector2D(x / w, y / w);
+	}
 	
 	/**************************************************************************/
 	/*!
 		This function sets the matrix pResult to the identity matrix
 	 */
 	/**************************************************************************/
-	void Mtx33Identity(Matrix3x3 &pResult);
+	CSD1130_INLINE constexpr void Mtx33Identity(Matrix3x3 &pResult) {
+		pResult = Matrix3x3(1.0f, 0.0f, 0.0f,
+							0.0f, 1.0f, 0.0f,
+							0.0f, 0.0f, 1.0f);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -83,7 +121,11 @@ namespace CSD1130
 		and saves it in pResult
 	 */
 	/**************************************************************************/
-	void Mtx33Translate(Matrix3x3 &pResult, float x, float y);
+	CSD1130_INLINE constexpr void Mtx33Translate(Matrix3x3 &pResult, float x, float y) {
+		pResult = Matrix3x3(1.0f, 0.0f, x,
+							0.0f, 1.0f, y,
+							0.0f, 0.0f, 1.0f);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -91,7 +133,11 @@ namespace CSD1130
 		and saves it in pResult
 	 */
 	/**************************************************************************/
-	void Mtx33Scale(Matrix3x3 &pResult, float x, float y);
+	CSD1130_INLINE constexpr void Mtx33Scale(Matrix3x3 &pResult, float x, float y) {
+		pResult = Matrix3x3(x, 0.0f, 0.0f,
+							0.0f, y, 0.0f,
+							0.0f, 0.0f, 1.0f);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -99,7 +145,12 @@ namespace CSD1130
 		is in radian. Save the resultant matrix in pResult.
 	 */
 	/**************************************************************************/
-	void Mtx33RotRad(Matrix3x3 &pResult, float angle);
+	CSD1130_INLINE void Mtx33RotRad(Matrix3x3 &pResult, float angle) {
+		float c = cosf(angle), s = sinf(angle);
+		pResult = Matrix3x3(c, -s, 0.0f,
+							s, c, 0.0f,
+							0.0f, 0.0f, 1.0f);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -107,7 +158,26 @@ namespace CSD1130
 		is in degree. Save the resultant matrix in pResult.
 	 */
 	/**************************************************************************/
-	void Mtx33RotDeg(Matrix3x3 &pResult, float angle);
+	CSD1130_INLINE void Mtx33RotDeg(Matrix3x3 &pResult, float angle) {
+		Mtx33RotRad(pResult, angle * 3.14159265358f / 180.0f);
+	}
+	
+	/**************************************************************************/
+	/*!
+		This function creates the matrix Translate(x, y) * Scale(scaleX, 
+		scaleY) * RotRad(angle), written out instead of multiplied, and 
+		saves it in pResult
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE void Mtx33Compose(Matrix3x3 &pResult, float x, float y, float scaleX, float scaleY, float angle) {
+		float c = cosf(angle), s = sinf(angle);
+
+		// the scale multiplies the rows of the rotation, the translation
+		// only fills the last column
+		pResult = Matrix3x3(scaleX * c, -(scaleX * s), x,
+							scaleY * s, scaleY * c, y,
+							0.0f, 0.0f, 1.0f);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -115,7 +185,12 @@ namespace CSD1130
 		and saves it in pResult
 	 */
 	/**************************************************************************/
-	void Mtx33Transpose(Matrix3x3 &pResult, const Matrix3x3 &pMtx);
+	CSD1130_INLINE constexpr void Mtx33Transpose(Matrix3x3 &pResult, const Matrix3x3 &pMtx) {
+		// through a copy, pResult may be pMtx
+		pResult = Matrix3x3(pMtx.m00, pMtx.m10, pMtx.m20,
+							pMtx.m01, pMtx.m11, pMtx.m21,
+							pMtx.m02, pMtx.m12, pMtx.m22);
+	}
 	
 	/**************************************************************************/
 	/*!
@@ -124,5 +199,34 @@ namespace CSD1130
 		would be set to NULL.
 	*/
 	/**************************************************************************/
-	void Mtx33Inverse(Matrix3x3 *pResult, float *determinant, const Matrix3x3 &pMtx);
-}
\ No newline at end of file
+	CSD1130_INLINE void Mtx33Inverse(Matrix3x3 *pResult, float *determinant, const Matrix3x3 &pMtx) {
+		float a = pMtx.m00, b = pMtx.m01, c = pMtx.m02,
+			d = pMtx.m10, e = pMtx.m11, f = pMtx.m12,
+			g = pMtx.m20, h = pMtx.m21, i = pMtx.m22;
+
+		float det = a * (e * i - f * h) -
+			b * (d * i - f * g) +
+			c * (d * h - e * g);
+
+		if (det == 0) {
+			// The matrix is singular, cannot be inverted
+			pResult = NULL;
+			return;
+		}
+
+		*determinant = det;
+
+		float invDet = 1.0f / det;
+
+		// Calculate the inverse matrix
+		pResult->m00 = (e * i - f * h) * invDet;
+		pResult->m01 = -(b * i - c * h) * invDet;
+		pResult->m02 = (b * f - c * e) * invDet;
+		pResult->m10 = -(d * i - f * g) * invDet;
+		pResult->m11 = (a * i - c * g) * invDet;
+		pResult->m12 = -(a * f - c * d) * invDet;
+		pResult->m20 = (d * h - e * g) * invDet;
+		pResult->m21 = -(a * h - b * g) * invDet;
+		pResult->m22 = (a * e - b * d) * invDet;
+	}
+}
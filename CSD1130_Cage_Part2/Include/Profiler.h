@@ -0,0 +1,74 @@
+/******************************************************************************/
+/*!
+\file		Profiler.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares a per-phase frame profiler together
+			with ProfilerInit, ProfilerEnable, ProfilerFrameBegin,
+			ProfilerScopeBegin, ProfilerScopeEnd, ProfilerWriteChromeTrace
+			and ProfilerShutdown, and the PROFILE_SCOPE macro.
+
+			PROFILE_SCOPE("name") times the rest of the enclosing block. The
+			scopes of the last frames are kept in a ring buffer of
+			PROFILER_FRAME_NUM frames, and ProfilerWriteChromeTrace saves
+			them as Chrome trace events, to be opened in chrome://tracing or
+			https://ui.perfetto.dev. A scope costs two clock reads while the
+			profiler is enabled and a branch while it is not.
+
+			Scopes are recorded from the main thread only: jobs running on
+			the JobSystem workers are timed as a whole by the scope around
+			JobSystemParallelFor.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_PROFILER_H_
+#define CSD1130_PROFILER_H_
+
+
+const unsigned int	PROFILER_FRAME_NUM			= 600;	//Number of frames kept in the ring buffer
+const unsigned int	PROFILER_FRAME_EVENT_MAX	= 32;	//Number of scopes kept per frame
+
+void ProfilerInit(		bool enabled);										//When true => start recording - input
+
+void ProfilerEnable(	bool enabled);										//When true => record, else skip scopes - input
+
+void ProfilerFrameBegin(void);
+
+long long ProfilerScopeBegin(	const char *pName);							//Name of the scope, must outlive the profiler - input
+
+void ProfilerScopeEnd(	long long scopeId);									//Value returned by ProfilerScopeBegin - input
+
+bool ProfilerWriteChromeTrace(	const char *pFileName);						//Path of the JSON file to write - input
+
+void ProfilerShutdown(void);
+
+
+/******************************************************************************/
+/*!
+*	ProfilerScope struct
+
+	Records the time between its construction and destruction.
+ */
+/******************************************************************************/
+struct ProfilerScope
+{
+	long long	m_scopeId;
+
+	explicit ProfilerScope(const char *pName) : m_scopeId(ProfilerScopeBegin(pName)) {}
+	~ProfilerScope() { ProfilerScopeEnd(m_scopeId); }
+
+	ProfilerScope(const ProfilerScope &) = delete;
+	ProfilerScope& operator=(const ProfilerScope &) = delete;
+};
+
+#define PROFILE_SCOPE_CONCAT2(a, b)		a##b
+#define PROFILE_SCOPE_CONCAT(a, b)		PROFILE_SCOPE_CONCAT2(a, b)
+#define PROFILE_SCOPE(name)				ProfilerScope PROFILE_SCOPE_CONCAT(profilerScope, __LINE__)(name)
+
+
+#endif // CSD1130_PROFILER_H_
@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*!
+\file		SpatialGrid.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the static uniform grid used as the
+			broadphase for ball-vs-wall and ball-vs-pillar collision,
+			together with SpatialGridBuild, SpatialGridQuery and
+			SpatialGridClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_SPATIAL_GRID_H_
+#define CSD1130_SPATIAL_GRID_H_
+
+#include "Collision.h"
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	SpatialGrid struct
+
+	Cells are square and stored row major. The items of cell c are
+	m_items[m_cellStart[c]] .. m_items[m_cellStart[c + 1] - 1].
+ */
+/******************************************************************************/
+struct SpatialGrid
+{
+	CSD1130::Vec2				m_origin;		// bottom-left corner of cell (0, 0)
+	float						m_cellSize{};
+	float						m_invCellSize{};
+	int							m_cols{};
+	int							m_rows{};
+
+	std::vector<unsigned int>	m_cellStart;	// m_cols * m_rows + 1 offsets into m_items
+	std::vector<unsigned int>	m_items;		// segment, then circle, indices bucketed per cell
+};
+
+void SpatialGridBuild(	SpatialGrid &grid,									//Grid reference - output
+						const LineSegment *pSegments,						//Static line segments - input
+						unsigned int segmentNum,							//Number of line segments - input
+						const Circle *pCircles,								//Static circles, indexed after the segments - input
+						unsigned int circleNum);							//Number of circles - input
+
+void SpatialGridQuery(	const SpatialGrid &grid,							//Grid - input
+						const AABB &aabb,									//Query box - input
+						std::vector<unsigned int> &result);					//Sorted, unique item indices - output
+
+void SpatialGridClear(	SpatialGrid &grid);									//Grid reference - input/output
+
+
+#endif // CSD1130_SPATIAL_GRID_H_
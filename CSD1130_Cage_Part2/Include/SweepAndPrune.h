@@ -0,0 +1,82 @@
+/******************************************************************************/
+/*!
+\file		SweepAndPrune.h
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This header file declares the sort-and-sweep broadphase used for
+			ball-vs-ball collision, together with SweepAndPruneUpdate,
+			SweepAndPruneFindPairs and SweepAndPruneClear.
+
+			The circles are kept sorted by the start of their x-interval.
+			Balls move little from one frame to the next, so the order of
+			the previous frame is almost right and an insertion sort fixes
+			it in about linear time.
+
+			Sweeping one sorted list would compare every circle with all
+			those in the same x-slab, which grows with the height of the
+			level. The sorted circles are instead dealt, in order, into
+			horizontal bands as high as the largest circle, so that each
+			band stays sorted and a circle is only swept against its own
+			band and the next one.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#ifndef CSD1130_SWEEP_AND_PRUNE_H_
+#define CSD1130_SWEEP_AND_PRUNE_H_
+
+#include <vector>
+
+
+/******************************************************************************/
+/*!
+*	SweepAndPruneEntry struct
+
+	Bounds of one circle, copied so that the sweep reads one array only
+ */
+/******************************************************************************/
+struct SweepAndPruneEntry
+{
+	float			m_minX;
+	float			m_maxX;
+	float			m_minY;
+	float			m_maxY;
+	unsigned int	m_idx;
+};
+
+/******************************************************************************/
+/*!
+*	SweepAndPrune struct
+ */
+/******************************************************************************/
+struct SweepAndPrune
+{
+	std::vector<SweepAndPruneEntry>	m_entries;		// sorted by m_minX
+	unsigned long long				m_swapNum{};	// insertion sort moves since the last full sort
+
+	// scratch of SweepAndPruneFindPairs: m_entries dealt into bands by
+	// m_minY, band b is m_banded[m_bandStart[b]] .. m_banded[m_bandStart[b + 1] - 1],
+	// with the band of each entry and the next free slot of each band
+	std::vector<SweepAndPruneEntry>	m_banded;
+	std::vector<unsigned int>		m_bandStart;
+	std::vector<unsigned int>		m_bands;
+	std::vector<unsigned int>		m_bandNext;
+};
+
+void SweepAndPruneUpdate(	SweepAndPrune &sap,								//Sweep and prune reference - input/output
+							const float *pPosX,								//Circle centers x - input
+							const float *pPosY,								//Circle centers y - input
+							const float *pRadius,							//Circle radii - input
+							unsigned int count);							//Number of circles - input
+
+void SweepAndPruneFindPairs(	SweepAndPrune &sap,							//Sweep and prune, updated - input/output
+								std::vector<unsigned int> &pairs);			//Index pairs whose boxes overlap, two entries per pair - output
+
+void SweepAndPruneClear(	SweepAndPrune &sap);							//Sweep and prune reference - input/output
+
+
+#endif // CSD1130_SWEEP_AND_PRUNE_H_
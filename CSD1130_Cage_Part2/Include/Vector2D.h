@@ -4,7 +4,20 @@
 \author 	Guo Yiming, yiming.guo, 2202613
 \par    	email: yiming.guo@digipen.edu
 \date   	Mar 18, 2023
-\brief		This header file declares the functions for Vector2D.
+\brief		This header file declares and defines the functions for Vector2D.
+
+			The math library is header only: every function is constexpr
+			where the standard allows it and CSD1130_INLINE otherwise, so a
+			dot product in the collision tests compiles to two multiplies
+			and an add instead of a call into another translation unit.
+
+			Vector2DNormalize divides by sqrtf unless CSD1130_FAST_NORMALIZE
+			is defined to 1, in which case it multiplies by a reciprocal
+			square root estimate refined by one Newton step (two without
+			SSE). The result is then within VECTOR2D_FAST_NORMALIZE_ERROR of
+			the exact one, which NormalizeBenchmark checks, but it is no
+			longer the same on every CPU: the SSE estimate differs between
+			vendors, so keep it off where runs must match across machines.
 
 Copyright (C) 2023 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -14,6 +27,31 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #pragma once
 
+#include <cmath>
+
+// 0: Vector2DNormalize is exact, 1: it uses Vector2DInvSqrtFast
+#ifndef CSD1130_FAST_NORMALIZE
+	#define CSD1130_FAST_NORMALIZE	0
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define CSD1130_RSQRT_SSE
+	#include <xmmintrin.h>
+#else
+	#include <cstring>
+#endif
+
+// Asks the compiler to inline even in builds that would otherwise not
+#ifndef CSD1130_INLINE
+	#if defined(_MSC_VER)
+		#define CSD1130_INLINE		__forceinline
+	#elif defined(__GNUC__) || defined(__clang__)
+		#define CSD1130_INLINE		inline __attribute__((always_inline))
+	#else
+		#define CSD1130_INLINE		inline
+	#endif
+#endif
+
 namespace CSD1130
 {
 	#ifdef _MSC_VER
@@ -36,21 +74,42 @@ namespace CSD1130
 		float m[2];
 
 		// Constructors
-		Vector2D() : x(0.0f), y(0.0f) {}
-		Vector2D(float _x, float _y);
+		constexpr Vector2D() : x(0.0f), y(0.0f) {}
+		constexpr Vector2D(float _x, float _y) : x(_x), y(_y) {}
 
 		//Do not change the following
 		Vector2D& operator=(const Vector2D& rhs) = default;
 		Vector2D(const Vector2D & rhs) = default;
 
 		// Assignment operators
-		Vector2D& operator += (const Vector2D &rhs);
-		Vector2D& operator -= (const Vector2D &rhs);
-		Vector2D& operator *= (float rhs);
-		Vector2D& operator /= (float rhs);
+		CSD1130_INLINE constexpr Vector2D& operator += (const Vector2D &rhs) {
+			x += rhs.x;
+			y += rhs.y;
+			return *this;
+		}
+
+		CSD1130_INLINE constexpr Vector2D& operator -= (const Vector2D &rhs) {
+			x -= rhs.x;
+			y -= rhs.y;
+			return *this;
+		}
+
+		CSD1130_INLINE constexpr Vector2D& operator *= (float rhs) {
+			x *= rhs;
+			y *= rhs;
+			return *this;
+		}
+
+		CSD1130_INLINE constexpr Vector2D& operator /= (float rhs) {
+			x /= rhs;
+			y /= rhs;
+			return *this;
+		}
 
 		// Unary operators
-		Vector2D operator -() const;
+		CSD1130_INLINE constexpr Vector2D operator -() const {
+			return Vector2D(-x, -y);
+		}
 
 	} Vector2D, Vec2, Point2D, Pt2;
 
@@ -61,62 +120,146 @@ namespace CSD1130
 	#endif
 
 	// Binary operators
-	Vector2D operator + (const Vector2D &lhs, const Vector2D &rhs);
-	Vector2D operator - (const Vector2D &lhs, const Vector2D &rhs);
-	Vector2D operator * (const Vector2D &lhs, float rhs);
-	Vector2D operator * (float lhs, const Vector2D &rhs);
-	Vector2D operator / (const Vector2D &lhs, float rhs);
+	CSD1130_INLINE constexpr Vector2D operator + (const Vector2D &lhs, const Vector2D &rhs) {
+		return Vector2D(lhs.x + rhs.x, lhs.y + rhs.y);
+	}
+
+	CSD1130_INLINE constexpr Vector2D operator - (const Vector2D &lhs, const Vector2D &rhs) {
+		return Vector2D(lhs.x - rhs.x, lhs.y - rhs.y);
+	}
+
+	CSD1130_INLINE constexpr Vector2D operator * (const Vector2D &lhs, float rhs) {
+		return Vector2D(lhs.x * rhs, lhs.y * rhs);
+	}
+
+	CSD1130_INLINE constexpr Vector2D operator * (float lhs, const Vector2D &rhs) {
+		return Vector2D(rhs.x * lhs, rhs.y * lhs);
+	}
+
+	CSD1130_INLINE constexpr Vector2D operator / (const Vector2D &lhs, float rhs) {
+		return Vector2D(lhs.x / rhs, lhs.y / rhs);
+	}
 
 	/**************************************************************************/
 	/*!
-		In this function, pResult will be the unit vector of pVec0
+		This function returns the length of the vector pVec0
 	 */
 	/**************************************************************************/
-	void	Vector2DNormalize(Vector2D &pResult, const Vector2D &pVec0);
-	
+	CSD1130_INLINE float	Vector2DLength(const Vector2D &pVec0) {
+		return sqrtf(pVec0.x * pVec0.x + pVec0.y * pVec0.y);
+	}
+
 	/**************************************************************************/
 	/*!
-		This function returns the length of the vector pVec0 
+		In this function, pResult will be the unit vector of pVec0, divided by
+		its length
 	 */
 	/**************************************************************************/
-	float	Vector2DLength(const Vector2D &pVec0);
-	
+	CSD1130_INLINE void	Vector2DNormalizeExact(Vector2D &pResult, const Vector2D &pVec0) {
+		pResult = pVec0 / Vector2DLength(pVec0);
+	}
+
+#if defined(CSD1130_RSQRT_SSE)
+	// Largest relative error of Vector2DInvSqrtFast, so of the length of
+	// Vector2DNormalizeFast's result, over the normal floats
+	const float VECTOR2D_FAST_NORMALIZE_ERROR = 1.0e-6f;
+#else
+	const float VECTOR2D_FAST_NORMALIZE_ERROR = 1.0e-5f;
+#endif
+
 	/**************************************************************************/
 	/*!
-		This function returns the square of pVec0's length. Avoid the square root 
+		This function returns an approximation of 1 / sqrtf(x), x > 0:
+		the SSE estimate (12 bits) or the bit trick estimate (about 5 bits)
+		without SSE, refined by Newton steps
 	 */
 	/**************************************************************************/
-	float	Vector2DSquareLength(const Vector2D &pVec0);
-	
+	CSD1130_INLINE float	Vector2DInvSqrtFast(float x) {
+#if defined(CSD1130_RSQRT_SSE)
+		float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#else
+		unsigned int i;
+		memcpy(&i, &x, sizeof(i));
+		i = 0x5f375a86u - (i >> 1);
+		float y;
+		memcpy(&y, &i, sizeof(y));
+		y = y * (1.5f - 0.5f * x * y * y);
+#endif
+		float halfX = 0.5f * x;
+		return y * (1.5f - halfX * y * y);
+	}
+
 	/**************************************************************************/
 	/*!
-		In this function, pVec0 and pVec1 are considered as 2D points.
-		The distance between these 2 2D points is returned
+		In this function, pResult will be the unit vector of pVec0, within
+		VECTOR2D_FAST_NORMALIZE_ERROR. pVec0 must not be zero
 	 */
 	/**************************************************************************/
-	float	Vector2DDistance(const Vector2D &pVec0, const Vector2D &pVec1);
-	
+	CSD1130_INLINE void	Vector2DNormalizeFast(Vector2D &pResult, const Vector2D &pVec0) {
+		pResult = pVec0 * Vector2DInvSqrtFast(pVec0.x * pVec0.x + pVec0.y * pVec0.y);
+	}
+
+	/**************************************************************************/
+	/*!
+		In this function, pResult will be the unit vector of pVec0.
+		Vector2DNormalizeFast when CSD1130_FAST_NORMALIZE is 1
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE void	Vector2DNormalize(Vector2D &pResult, const Vector2D &pVec0) {
+#if CSD1130_FAST_NORMALIZE
+		Vector2DNormalizeFast(pResult, pVec0);
+#else
+		Vector2DNormalizeExact(pResult, pVec0);
+#endif
+	}
+
+	/**************************************************************************/
+	/*!
+		This function returns the square of pVec0's length. Avoid the square root
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE constexpr float	Vector2DSquareLength(const Vector2D &pVec0) {
+		return pVec0.x * pVec0.x + pVec0.y * pVec0.y;
+	}
+
 	/**************************************************************************/
 	/*!
 		In this function, pVec0 and pVec1 are considered as 2D points.
-		The squared distance between these 2 2D points is returned. 
+		The squared distance between these 2 2D points is returned.
 		Avoid the square root
 	 */
 	/**************************************************************************/
-	float	Vector2DSquareDistance(const Vector2D &pVec0, const Vector2D &pVec1);
-	
+	CSD1130_INLINE constexpr float	Vector2DSquareDistance(const Vector2D &pVec0, const Vector2D &pVec1) {
+		float dx = pVec1.x - pVec0.x, dy = pVec1.y - pVec0.y;
+		return dx * dx + dy * dy;
+	}
+
+	/**************************************************************************/
+	/*!
+		In this function, pVec0 and pVec1 are considered as 2D points.
+		The distance between these 2 2D points is returned
+	 */
+	/**************************************************************************/
+	CSD1130_INLINE float	Vector2DDistance(const Vector2D &pVec0, const Vector2D &pVec1) {
+		return sqrtf(Vector2DSquareDistance(pVec0, pVec1));
+	}
+
 	/**************************************************************************/
 	/*!
 		This function returns the dot product between pVec0 and pVec1
 	 */
 	/**************************************************************************/
-	float	Vector2DDotProduct(const Vector2D &pVec0, const Vector2D &pVec1);
-	
+	CSD1130_INLINE constexpr float	Vector2DDotProduct(const Vector2D &pVec0, const Vector2D &pVec1) {
+		return pVec0.x * pVec1.x + pVec0.y * pVec1.y;
+	}
+
 	/**************************************************************************/
 	/*!
-		This function returns the cross product magnitude 
+		This function returns the cross product magnitude
 		between pVec0 and pVec1
 	 */
 	/**************************************************************************/
-	float	Vector2DCrossProductMag(const Vector2D &pVec0, const Vector2D &pVec1);
-}
\ No newline at end of file
+	CSD1130_INLINE constexpr float	Vector2DCrossProductMag(const Vector2D &pVec0, const Vector2D &pVec1) {
+		return pVec0.x * pVec1.y - pVec0.y * pVec1.x;
+	}
+}
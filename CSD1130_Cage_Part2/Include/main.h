@@ -29,14 +29,22 @@ extern double	g_appTime;
 #include "Math.h"
 #include "Vector2D.h"
 #include "Matrix3x3.h"
+#include "Affine2D.h"
 
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "GameStateMgr.h"
 #include "GameState_Cage.h"
 #include "Collision.h"
+#include "LevelData.h"
+#include "LevelBinary.h"
+#include "LevelArena.h"
+#include "CageSimulation.h"
+#include "CageReplay.h"
+#include "Profiler.h"
 
 
 extern s8	fontId;
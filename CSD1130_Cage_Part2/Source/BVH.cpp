@@ -0,0 +1,420 @@
+/******************************************************************************/
+/*!
+\file		BVH.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for StaticBVHBuild,
+			StaticBVHQuery and StaticBVHClear.
+
+			The tree is built top-down with a binned surface area heuristic
+			(in 2D the "surface" of a box is its perimeter).
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "BVH.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	const unsigned int	BVH_BIN_NUM			= 16;	// SAH candidate buckets per split
+	const unsigned int	BVH_LEAF_MIN		= 2;	// never split nodes this small
+	const unsigned int	BVH_LEAF_MAX		= 8;	// always split nodes larger than this
+	const unsigned int	BVH_SAH_DEPTH_MAX	= 32;	// median splits below, bounds the depth
+	const unsigned int	BVH_STACK_MAX		= 64;	// > BVH_SAH_DEPTH_MAX + log2(2^32)
+
+	// Relative cost of visiting a node against testing one primitive
+	const float			BVH_TRAVERSAL_COST	= 1.0f;
+
+	/**************************************************************************/
+	/*!
+		Grows aabb so that it also contains other
+	 */
+	/**************************************************************************/
+	void Grow(AABB &aabb, const AABB &other)
+	{
+		aabb.m_min.x = std::min(aabb.m_min.x, other.m_min.x);
+		aabb.m_min.y = std::min(aabb.m_min.y, other.m_min.y);
+		aabb.m_max.x = std::max(aabb.m_max.x, other.m_max.x);
+		aabb.m_max.y = std::max(aabb.m_max.y, other.m_max.y);
+	}
+
+	/**************************************************************************/
+	/*!
+		Half perimeter of aabb, the 2D counterpart of the surface area
+	 */
+	/**************************************************************************/
+	float HalfPerimeter(const AABB &aabb)
+	{
+		return (aabb.m_max.x - aabb.m_min.x) + (aabb.m_max.y - aabb.m_min.y);
+	}
+
+	/**************************************************************************/
+	/*!
+		Returns the x (axis 0) or y (axis 1) coordinate of the box center
+	 */
+	/**************************************************************************/
+	float Centroid(const AABB &aabb, int axis)
+	{
+		return 0.5f * (aabb.m_min.m[axis] + aabb.m_max.m[axis]);
+	}
+
+	/**************************************************************************/
+	/*!
+		Returns true if the segment p + t * d, t in [0, 1], touches aabb
+	 */
+	/**************************************************************************/
+	bool SegmentOverlapsAABB(const CSD1130::Vec2 &p, const CSD1130::Vec2 &d, const AABB &aabb)
+	{
+		float tMin = 0.0f, tMax = 1.0f;
+
+		for (int axis = 0; axis < 2; ++axis) {
+			if (d.m[axis] == 0.0f) {
+				// Parallel to this slab: it must start inside of it
+				if (p.m[axis] < aabb.m_min.m[axis] || p.m[axis] > aabb.m_max.m[axis])
+					return false;
+				continue;
+			}
+
+			float invD	= 1.0f / d.m[axis];
+			float t0	= (aabb.m_min.m[axis] - p.m[axis]) * invD;
+			float t1	= (aabb.m_max.m[axis] - p.m[axis]) * invD;
+			if (t0 > t1)
+				std::swap(t0, t1);
+
+			tMin = std::max(tMin, t0);
+			tMax = std::min(tMax, t1);
+			if (tMin > tMax)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**************************************************************************/
+	/*!
+		Builder state shared by the recursive calls
+	 */
+	/**************************************************************************/
+	struct BVHBuilder
+	{
+		StaticBVH			&bvh;
+		const AABB			*pBoxes;
+	};
+
+	/**************************************************************************/
+	/*!
+		Builds the subtree over bvh.m_items[first] .. [first + count - 1]
+		and returns the index of its root node.
+	 */
+	/**************************************************************************/
+	unsigned int BuildNode(BVHBuilder &builder, unsigned int first, unsigned int count, unsigned int depth)
+	{
+		StaticBVH &bvh = builder.bvh;
+		unsigned int *pItems = bvh.m_items.data();
+
+		unsigned int nodeIdx = (unsigned int)bvh.m_nodes.size();
+		bvh.m_nodes.emplace_back();
+
+		// Bounds of the primitives and of their centroids
+		AABB aabb = builder.pBoxes[pItems[first]];
+		AABB centroids;
+		centroids.m_min = centroids.m_max = CSD1130::Vec2(Centroid(aabb, 0), Centroid(aabb, 1));
+
+		for (unsigned int i = first; i < first + count; ++i) {
+			const AABB &box = builder.pBoxes[pItems[i]];
+			Grow(aabb, box);
+
+			AABB c;
+			c.m_min = c.m_max = CSD1130::Vec2(Centroid(box, 0), Centroid(box, 1));
+			Grow(centroids, c);
+		}
+
+		bvh.m_nodes[nodeIdx].m_aabb = aabb;
+
+		// Split along the axis in which the centroids are most spread out
+		int axis = (centroids.m_max.x - centroids.m_min.x >= centroids.m_max.y - centroids.m_min.y) ? 0 : 1;
+		float cMin		= centroids.m_min.m[axis];
+		float cExtent	= centroids.m_max.m[axis] - cMin;
+
+		if (count <= BVH_LEAF_MIN || (cExtent <= 0.0f && count <= BVH_LEAF_MAX)) {
+			bvh.m_nodes[nodeIdx].m_first = first;
+			bvh.m_nodes[nodeIdx].m_count = count;
+			return nodeIdx;
+		}
+
+		unsigned int mid = first;
+
+		if (cExtent > 0.0f && depth < BVH_SAH_DEPTH_MAX) {
+			// Bin the primitives by centroid
+			AABB			binAABB[BVH_BIN_NUM];
+			unsigned int	binCount[BVH_BIN_NUM] = {};
+			float			binScale = (float)BVH_BIN_NUM / cExtent;
+
+			for (unsigned int i = first; i < first + count; ++i) {
+				const AABB &box = builder.pBoxes[pItems[i]];
+				unsigned int bin = std::min((unsigned int)((Centroid(box, axis) - cMin) * binScale), BVH_BIN_NUM - 1);
+				if (binCount[bin]++ == 0)
+					binAABB[bin] = box;
+				else
+					Grow(binAABB[bin], box);
+			}
+
+			// Sweep from the right to get the cost of every right side,
+			// then from the left to evaluate each split plane
+			float			rightCost[BVH_BIN_NUM] = {};
+			AABB			acc;
+			unsigned int	accCount = 0;
+
+			for (unsigned int b = BVH_BIN_NUM - 1; b > 0; --b) {
+				if (binCount[b]) {
+					if (accCount == 0)
+						acc = binAABB[b];
+					else
+						Grow(acc, binAABB[b]);
+					accCount += binCount[b];
+				}
+				rightCost[b] = accCount ? HalfPerimeter(acc) * (float)accCount : 0.0f;
+			}
+
+			float			bestCost = INFINITY;
+			unsigned int	bestBin = 0;
+			accCount = 0;
+
+			for (unsigned int b = 0; b < BVH_BIN_NUM - 1; ++b) {
+				if (binCount[b]) {
+					if (accCount == 0)
+						acc = binAABB[b];
+					else
+						Grow(acc, binAABB[b]);
+					accCount += binCount[b];
+				}
+				if (accCount == 0 || accCount == count)
+					continue;
+
+				float cost = HalfPerimeter(acc) * (float)accCount + rightCost[b + 1];
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestBin = b;
+				}
+			}
+
+			// Keep small nodes as leaves when splitting does not pay off
+			float leafCost = HalfPerimeter(aabb) * (float)count;
+			float splitCost = BVH_TRAVERSAL_COST * HalfPerimeter(aabb) + bestCost;
+			if (count <= BVH_LEAF_MAX && leafCost <= splitCost) {
+				bvh.m_nodes[nodeIdx].m_first = first;
+				bvh.m_nodes[nodeIdx].m_count = count;
+				return nodeIdx;
+			}
+
+			if (bestCost < INFINITY) {
+				unsigned int *pMid = std::partition(pItems + first, pItems + first + count,
+					[&](unsigned int item) {
+						float c = Centroid(builder.pBoxes[item], axis);
+						return std::min((unsigned int)((c - cMin) * binScale), BVH_BIN_NUM - 1) <= bestBin;
+					});
+				mid = (unsigned int)(pMid - pItems);
+			}
+		}
+
+		// Degenerate or too deep: fall back to an object median split
+		if (mid == first || mid == first + count) {
+			mid = first + count / 2;
+			std::nth_element(pItems + first, pItems + mid, pItems + first + count,
+				[&](unsigned int a, unsigned int b) {
+					return Centroid(builder.pBoxes[a], axis) < Centroid(builder.pBoxes[b], axis);
+				});
+		}
+
+		BuildNode(builder, first, mid - first, depth + 1);
+		unsigned int right = BuildNode(builder, mid, first + count - mid, depth + 1);
+
+		bvh.m_nodes[nodeIdx].m_first = right;
+		bvh.m_nodes[nodeIdx].m_count = 0;
+		return nodeIdx;
+	}
+
+	/**************************************************************************/
+	/*!
+		Walks the tree and collects the items of every leaf accepted by
+		overlaps, in increasing order.
+	 */
+	/**************************************************************************/
+	template <typename Overlaps>
+	void Traverse(const StaticBVH &bvh, Overlaps overlaps, std::vector<unsigned int> &result)
+	{
+		result.clear();
+
+		if (bvh.m_nodes.empty())
+			return;
+
+		unsigned int stack[BVH_STACK_MAX];
+		unsigned int top = 0;
+		unsigned int nodeIdx = 0;
+
+		for (;;) {
+			const BVHNode &node = bvh.m_nodes[nodeIdx];
+
+			if (overlaps(node.m_aabb)) {
+				if (node.m_count) {
+					result.insert(result.end(), bvh.m_items.begin() + node.m_first,
+						bvh.m_items.begin() + node.m_first + node.m_count);
+				}
+				else {
+					stack[top++] = node.m_first;
+					nodeIdx = nodeIdx + 1;
+					continue;
+				}
+			}
+
+			if (top == 0)
+				break;
+			nodeIdx = stack[--top];
+		}
+
+		// Callers resolve collisions in increasing wall order
+		std::sort(result.begin(), result.end());
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the hierarchy over an array of primitive bounding boxes.
+*
+* \param [out]	bvh				Reference to StaticBVH to be built.
+*
+* \param [in]	pBoxes			Pointer to the first bounding box.
+*
+* \param [in]	boxNum			Number of bounding boxes in pBoxes.
+ */
+/******************************************************************************/
+void StaticBVHBuild(StaticBVH &bvh,
+	const AABB *pBoxes,
+	unsigned int boxNum)
+{
+	StaticBVHClear(bvh);
+
+	if (boxNum == 0)
+		return;
+
+	bvh.m_items.resize(boxNum);
+	for (unsigned int i = 0; i < boxNum; ++i)
+		bvh.m_items[i] = i;
+
+	// A binary tree with at most one primitive per leaf has 2n - 1 nodes
+	bvh.m_nodes.reserve(2 * (size_t)boxNum - 1);
+
+	BVHBuilder builder{ bvh, pBoxes };
+	BuildNode(builder, 0, boxNum, 0);
+
+	bvh.m_nodes.shrink_to_fit();
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the hierarchy over static arrays of line segments and
+		 circles. Circle i is primitive segmentNum + i.
+*
+* \param [out]	bvh				Reference to StaticBVH to be built.
+*
+* \param [in]	pSegments		Pointer to the first line segment.
+*
+* \param [in]	segmentNum		Number of line segments in pSegments.
+*
+* \param [in]	pCircles		Pointer to the first circle.
+*
+* \param [in]	circleNum		Number of circles in pCircles.
+ */
+/******************************************************************************/
+void StaticBVHBuild(StaticBVH &bvh,
+	const LineSegment *pSegments,
+	unsigned int segmentNum,
+	const Circle *pCircles,
+	unsigned int circleNum)
+{
+	std::vector<AABB> boxes(segmentNum + circleNum);
+	for (unsigned int i = 0; i < segmentNum; ++i)
+		BuildAABB(boxes[i], pSegments[i]);
+	for (unsigned int i = 0; i < circleNum; ++i)
+		BuildAABB(boxes[segmentNum + i], pCircles[i]);
+
+	StaticBVHBuild(bvh, boxes.data(), segmentNum + circleNum);
+}
+
+/******************************************************************************/
+/*!
+* \brief Collects the primitives whose leaf overlaps a box.
+*
+* \param [in]	bvh				Const reference to a built StaticBVH.
+*
+* \param [in]	aabb			Const reference to the query box.
+*
+* \param [out]	result			Cleared, then filled with the candidate
+								primitive indices in increasing order.
+ */
+/******************************************************************************/
+void StaticBVHQuery(const StaticBVH &bvh,
+	const AABB &aabb,
+	std::vector<unsigned int> &result)
+{
+	Traverse(bvh, [&](const AABB &nodeAABB) { return AABBOverlap(nodeAABB, aabb); }, result);
+}
+
+/******************************************************************************/
+/*!
+* \brief Collects the primitives a circle may touch while moving from its
+		 center to ptEnd.
+*
+* \param [in]	bvh				Const reference to a built StaticBVH.
+*
+* \param [in]	circle			Const reference to Circle containing
+								start pos of the circle and its radius.
+*
+* \param [in]	ptEnd			Const reference to CSD1130::Vec2 containing
+								end pos of the circle.
+*
+* \param [out]	result			Cleared, then filled with the candidate
+								primitive indices in increasing order.
+ */
+/******************************************************************************/
+void StaticBVHQuery(const StaticBVH &bvh,
+	const Circle &circle,
+	const CSD1130::Vec2 &ptEnd,
+	std::vector<unsigned int> &result)
+{
+	AABB sweptAABB;
+	BuildAABB(sweptAABB, circle, ptEnd);
+	CSD1130::Vec2 V = ptEnd - circle.m_center;
+
+	Traverse(bvh, [&](const AABB &nodeAABB) {
+		if (!AABBOverlap(nodeAABB, sweptAABB))
+			return false;
+
+		// Tighter for diagonal moves: the path of the center against the
+		// node box grown by the radius
+		AABB grown = nodeAABB;
+		grown.m_min.x -= circle.m_radius;
+		grown.m_min.y -= circle.m_radius;
+		grown.m_max.x += circle.m_radius;
+		grown.m_max.y += circle.m_radius;
+		return SegmentOverlapsAABB(circle.m_center, V, grown);
+	}, result);
+}
+
+/******************************************************************************/
+/*!
+* \brief Releases the memory held by a hierarchy and resets it to empty.
+*
+* \param [in,out]	bvh			Reference to StaticBVH to be cleared.
+ */
+/******************************************************************************/
+void StaticBVHClear(StaticBVH &bvh)
+{
+	bvh = StaticBVH();
+}
@@ -0,0 +1,159 @@
+/******************************************************************************/
+/*!
+\file		BallStore.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for BallStoreReserve,
+			BallStoreAdd, BallStoreRemove, BallStoreSavePositions,
+			BallStoreRemoveAll and BallStoreClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "BallStore.h"
+
+/******************************************************************************/
+/*!
+* \brief Makes room for capacity balls without reallocating.
+*
+* \param [in,out]	store		Reference to the BallStore.
+*
+* \param [in]		capacity	Number of balls to make room for.
+ */
+/******************************************************************************/
+void BallStoreReserve(BallStore &store,
+	unsigned int capacity)
+{
+	store.m_posX.reserve(capacity);
+	store.m_posY.reserve(capacity);
+	store.m_velX.reserve(capacity);
+	store.m_velY.reserve(capacity);
+	store.m_radius.reserve(capacity);
+	store.m_speed.reserve(capacity);
+	store.m_prevPosX.reserve(capacity);
+	store.m_prevPosY.reserve(capacity);
+}
+
+/******************************************************************************/
+/*!
+* \brief Appends a ball to the store.
+*
+* \param [in,out]	store		Reference to the BallStore.
+*
+* \param [in]		pos			Const reference to the ball position.
+*
+* \param [in]		vel			Const reference to the ball velocity.
+*
+* \param [in]		radius		Radius of the ball.
+*
+* \param [in]		speed		Speed of the ball, kept when it bounces.
+*
+  \return			unsigned int	Index of the new ball.
+ */
+/******************************************************************************/
+unsigned int BallStoreAdd(BallStore &store,
+	const CSD1130::Vec2 &pos,
+	const CSD1130::Vec2 &vel,
+	float radius,
+	float speed)
+{
+	store.m_posX.push_back(pos.x);
+	store.m_posY.push_back(pos.y);
+	store.m_velX.push_back(vel.x);
+	store.m_velY.push_back(vel.y);
+	store.m_radius.push_back(radius);
+	store.m_speed.push_back(speed);
+	store.m_prevPosX.push_back(pos.x);
+	store.m_prevPosY.push_back(pos.y);
+
+	return store.m_count++;
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes a ball by moving the last ball into its slot.
+*
+* \param [in,out]	store		Reference to the BallStore.
+*
+* \param [in]		ballIdx		Index of the ball to remove.
+*
+  \return			unsigned int	Previous index of the ball that now lives
+									at ballIdx. Equal to ballIdx when the
+									removed ball was the last one.
+ */
+/******************************************************************************/
+unsigned int BallStoreRemove(BallStore &store,
+	unsigned int ballIdx)
+{
+	unsigned int last = --store.m_count;
+
+	store.m_posX[ballIdx]		= store.m_posX[last];
+	store.m_posY[ballIdx]		= store.m_posY[last];
+	store.m_velX[ballIdx]		= store.m_velX[last];
+	store.m_velY[ballIdx]		= store.m_velY[last];
+	store.m_radius[ballIdx]		= store.m_radius[last];
+	store.m_speed[ballIdx]		= store.m_speed[last];
+	store.m_prevPosX[ballIdx]	= store.m_prevPosX[last];
+	store.m_prevPosY[ballIdx]	= store.m_prevPosY[last];
+
+	store.m_posX.pop_back();
+	store.m_posY.pop_back();
+	store.m_velX.pop_back();
+	store.m_velY.pop_back();
+	store.m_radius.pop_back();
+	store.m_speed.pop_back();
+	store.m_prevPosX.pop_back();
+	store.m_prevPosY.pop_back();
+
+	return last;
+}
+
+/******************************************************************************/
+/*!
+* \brief Copies the position of every ball into its previous position.
+*
+* \param [in,out]	store		Reference to the BallStore.
+ */
+/******************************************************************************/
+void BallStoreSavePositions(BallStore &store)
+{
+	store.m_prevPosX.assign(store.m_posX.begin(), store.m_posX.end());
+	store.m_prevPosY.assign(store.m_posY.begin(), store.m_posY.end());
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes every ball and keeps the memory held by the store, so that
+		 adding the same balls again does not allocate.
+*
+* \param [in,out]	store		Reference to the BallStore.
+ */
+/******************************************************************************/
+void BallStoreRemoveAll(BallStore &store)
+{
+	store.m_posX.clear();
+	store.m_posY.clear();
+	store.m_velX.clear();
+	store.m_velY.clear();
+	store.m_radius.clear();
+	store.m_speed.clear();
+	store.m_prevPosX.clear();
+	store.m_prevPosY.clear();
+	store.m_count = 0;
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes every ball and releases the memory held by the store.
+*
+* \param [in,out]	store		Reference to the BallStore.
+ */
+/******************************************************************************/
+void BallStoreClear(BallStore &store)
+{
+	store = BallStore();
+}
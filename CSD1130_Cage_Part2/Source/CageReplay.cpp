@@ -0,0 +1,197 @@
+/******************************************************************************/
+/*!
+\file		CageReplay.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for CageReplayBegin,
+			CageReplayRecord, CageReplayWrite, CageReplayRead,
+			CageReplayNext, CageReplayLevel and CageReplayClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CageReplay.h"
+#include <fstream>
+
+/******************************************************************************/
+/*!
+* \brief Starts a new log with the settings and the level of a run.
+*
+* \param [out]	replay			Reference to the CageReplay.
+*
+* \param [in]	settings		Const reference to the simulation settings.
+*
+* \param [in]	level			Const reference to the compiled level the
+								run starts with.
+ */
+/******************************************************************************/
+void CageReplayBegin(CageReplay &replay,
+	const CageReplaySettings &settings,
+	const LevelBinary &level)
+{
+	CageReplayClear(replay);
+	replay.m_settings = settings;
+
+	if (level.m_pHeader) {
+		const unsigned char *pData = (const unsigned char *)level.m_pHeader;
+		replay.m_level.assign(pData, pData + level.m_pHeader->m_size);
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Appends a frame to the log.
+*
+* \param [in,out]	replay		Reference to the CageReplay.
+*
+* \param [in]		frameDt		Time of the frame, as given to CageSimAdvance.
+*
+* \param [in]		keys		CAGE_REPLAY_KEY_* triggered in the frame.
+ */
+/******************************************************************************/
+void CageReplayRecord(CageReplay &replay,
+	float frameDt,
+	unsigned char keys)
+{
+	replay.m_frameDt.push_back(frameDt);
+	replay.m_frameKeys.push_back(keys);
+}
+
+/******************************************************************************/
+/*!
+* \brief Saves the log.
+*
+* \param [in]	replay			Const reference to the CageReplay.
+*
+* \param [in]	pFileName		Path of the log to write.
+*
+  \return		bool			returns false if the file cannot be written.
+ */
+/******************************************************************************/
+bool CageReplayWrite(const CageReplay &replay,
+	const char *pFileName)
+{
+	std::ofstream outFile(pFileName, std::ios::binary);
+	if (!outFile.is_open())
+		return false;
+
+	CageReplayHeader header{};
+	header.m_magic			= CAGE_REPLAY_MAGIC;
+	header.m_version		= CAGE_REPLAY_VERSION;
+	header.m_fastNormalize	= CSD1130_FAST_NORMALIZE;
+	header.m_settings		= replay.m_settings;
+	header.m_levelSize		= (unsigned int)replay.m_level.size();
+	header.m_frameNum		= (unsigned int)replay.m_frameDt.size();
+
+	outFile.write((const char *)&header, sizeof(header));
+	outFile.write((const char *)replay.m_level.data(), replay.m_level.size());
+	outFile.write((const char *)replay.m_frameDt.data(), replay.m_frameDt.size() * sizeof(float));
+	outFile.write((const char *)replay.m_frameKeys.data(), replay.m_frameKeys.size());
+	outFile.close();
+	return !outFile.fail();
+}
+
+/******************************************************************************/
+/*!
+* \brief Reads a log saved by CageReplayWrite, ready to replay from its
+		 first frame.
+*
+* \param [out]	replay			Reference to the CageReplay.
+*
+* \param [in]	pFileName		Path of the log to read.
+*
+  \return		bool			returns false if the file cannot be read, is
+								not a replay log, or was recorded by a build
+								that normalizes vectors another way.
+ */
+/******************************************************************************/
+bool CageReplayRead(CageReplay &replay,
+	const char *pFileName)
+{
+	CageReplayClear(replay);
+
+	std::ifstream inFile(pFileName, std::ios::binary);
+	if (!inFile.is_open())
+		return false;
+
+	CageReplayHeader header{};
+	if (!inFile.read((char *)&header, sizeof(header)) ||
+		header.m_magic != CAGE_REPLAY_MAGIC ||
+		header.m_version != CAGE_REPLAY_VERSION ||
+		header.m_fastNormalize != CSD1130_FAST_NORMALIZE)
+		return false;
+
+	replay.m_settings = header.m_settings;
+	replay.m_level.resize(header.m_levelSize);
+	replay.m_frameDt.resize(header.m_frameNum);
+	replay.m_frameKeys.resize(header.m_frameNum);
+
+	if (!inFile.read((char *)replay.m_level.data(), replay.m_level.size()) ||
+		!inFile.read((char *)replay.m_frameDt.data(), replay.m_frameDt.size() * sizeof(float)) ||
+		!inFile.read((char *)replay.m_frameKeys.data(), replay.m_frameKeys.size())) {
+		CageReplayClear(replay);
+		return false;
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/*!
+* \brief Gives the next frame of the log.
+*
+* \param [in,out]	replay		Reference to the CageReplay.
+*
+* \param [out]		frameDt		Time of the frame.
+*
+* \param [out]		keys		CAGE_REPLAY_KEY_* triggered in the frame.
+*
+  \return			bool		returns false once every frame was given.
+ */
+/******************************************************************************/
+bool CageReplayNext(CageReplay &replay,
+	float &frameDt,
+	unsigned char &keys)
+{
+	if (replay.m_frameIdx >= replay.m_frameDt.size())
+		return false;
+
+	frameDt	= replay.m_frameDt[replay.m_frameIdx];
+	keys	= replay.m_frameKeys[replay.m_frameIdx];
+	++replay.m_frameIdx;
+	return true;
+}
+
+/******************************************************************************/
+/*!
+* \brief Loads the level the recorded run started with.
+*
+* \param [in]	replay			Const reference to the CageReplay.
+*
+* \param [out]	level			Reference to LevelBinary to be set.
+*
+  \return		bool			returns false if the level was compiled by
+								another build.
+ */
+/******************************************************************************/
+bool CageReplayLevel(const CageReplay &replay,
+	LevelBinary &level)
+{
+	return LevelBinaryLoad(level, replay.m_level.data(), replay.m_level.size());
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes every frame and releases the memory held by the log.
+*
+* \param [in,out]	replay		Reference to the CageReplay.
+ */
+/******************************************************************************/
+void CageReplayClear(CageReplay &replay)
+{
+	replay = CageReplay();
+}
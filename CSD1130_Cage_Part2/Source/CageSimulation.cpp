@@ -0,0 +1,910 @@
+/******************************************************************************/
+/*!
+\file		CageSimulation.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for CageSimInit,
+			CageSimRestart, CageSimRemoveBall, CageSimStep,
+			CageSimWallCandidates, CageSimWallTestNum, CageSimBallTestNum
+			and CageSimClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CageSimulation.h"
+#include "Profiler.h"
+#include <algorithm>
+
+namespace
+{
+	// Number of balls per job of a parallel step
+	const unsigned int	BALL_CHUNK_NUM	= 64;
+
+	// Shortest path left after an impact that is reflected: a shorter one
+	// has no reliable direction, and none at all when it is zero
+	const float			PATH_LEFT_MIN	= 1.0e-3f;
+
+	// What the jobs of one step share
+	struct StepJobData
+	{
+		CageSimulation	*pSim;
+		float			dt;
+	};
+
+	/**************************************************************************/
+	/*!
+		Computes where the balls [begin, end) end up after dt when they hit
+		nothing
+	 */
+	/**************************************************************************/
+	void IntegrateBalls(CageSimulation &sim, float dt, unsigned int begin, unsigned int end)
+	{
+		const BallStore &balls = sim.m_balls;
+		const float *pPosX	= balls.m_posX.data();
+		const float *pPosY	= balls.m_posY.data();
+		const float *pVelX	= balls.m_velX.data();
+		const float *pVelY	= balls.m_velY.data();
+		float *pNextX		= sim.m_posNextX.data();
+		float *pNextY		= sim.m_posNextY.data();
+
+		for (unsigned int i = begin; i < end; ++i) {
+			pNextX[i] = pPosX[i] + pVelX[i] * dt;
+			pNextY[i] = pPosY[i] + pVelY[i] * dt;
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		Tests a ball moving at velX, velY from ballData.m_center to ptEnd
+		against obstacle obstacleIdx: a wall it moves towards, or a pillar
+	 */
+	/**************************************************************************/
+	int CollideObstacle(const CageSimulation &sim, unsigned int obstacleIdx,
+		const Circle &ballData, const CSD1130::Vec2 &ptEnd, float velX, float velY,
+		CSD1130::Vec2 &interPt, CSD1130::Vec2 &normalAtCollision, float &interTime)
+	{
+		if (obstacleIdx >= sim.m_wallNum)
+			return CollisionIntersection_MovingCircleCircle(ballData,
+				ptEnd,
+				sim.m_pPillars[obstacleIdx - sim.m_wallNum],
+				interPt,
+				normalAtCollision,
+				interTime);
+
+		const LineSegment &lineSegData = sim.m_pWalls[obstacleIdx];
+		if ((velX * lineSegData.m_normal.x + velY * lineSegData.m_normal.y) >= 0.0f)
+			return 0;
+
+		bool checkLineEdges = sim.m_checkLineEdges;
+		return CollisionIntersection_CircleLineSegment(ballData,
+			ptEnd,
+			lineSegData,
+			interPt,
+			normalAtCollision,
+			interTime,
+			checkLineEdges);
+	}
+
+	/**************************************************************************/
+	/*!
+		Reflects a ball that hits an obstacle at hitPt: its velocity, and
+		posNext, the end of its path, about the normal there. A ball that
+		hits at the end of its path stops at the impact with its velocity
+		reflected, and false is returned: it has no path left to check
+	 */
+	/**************************************************************************/
+	bool ReflectBall(const CSD1130::Vec2 &hitPt, const CSD1130::Vec2 &hitNormal, float speed,
+		CSD1130::Vec2 &posNext, float &velX, float &velY)
+	{
+		if (CSD1130::Vector2DSquareDistance(posNext, hitPt) < PATH_LEFT_MIN * PATH_LEFT_MIN) {
+			CSD1130::Vec2 vel(velX, velY);
+			vel = vel - 2 * CSD1130::Vector2DDotProduct(vel, hitNormal) * hitNormal;
+
+			posNext	= hitPt;
+			velX	= vel.x;
+			velY	= vel.y;
+			return false;
+		}
+
+		// a pillar reflects the ball like a wall along its tangent
+		CSD1130::Vec2 reflectedVec;
+
+		CollisionResponse_CircleLineSegment(hitPt,
+			hitNormal,
+			posNext,
+			reflectedVec);
+
+		velX = reflectedVec.x * speed;
+		velY = reflectedVec.y * speed;
+		return true;
+	}
+
+	/**************************************************************************/
+	/*!
+		Moves the balls [begin, end) to their integrated position,
+		reflecting them on the walls and pillars they hit in index order. Only those
+		balls are written, candidates is the scratch buffer of the calling
+		worker
+	 */
+	/**************************************************************************/
+	void CollideBallsInOrder(CageSimulation &sim, unsigned int begin, unsigned int end,
+		std::vector<unsigned int> &candidates, unsigned long long &wallTestNum)
+	{
+		CSD1130::Vec2	interPtA;
+		CSD1130::Vec2	normalAtCollision;
+		float			interTime = 0.0f;
+
+		BallStore &balls = sim.m_balls;
+		float *pPosX			= balls.m_posX.data();
+		float *pPosY			= balls.m_posY.data();
+		float *pVelX			= balls.m_velX.data();
+		float *pVelY			= balls.m_velY.data();
+		const float *pRadius	= balls.m_radius.data();
+		const float *pSpeed		= balls.m_speed.data();
+		const float *pNextX		= sim.m_posNextX.data();
+		const float *pNextY		= sim.m_posNextY.data();
+
+		unsigned long long testNum = 0;
+
+		for (unsigned int i = begin; i < end; ++i) {
+			CSD1130::Vec2 posNext;
+			posNext.x = pNextX[i];
+			posNext.y = pNextY[i];
+
+			// Ball data at the start of this step
+			Circle ballData;
+			ballData.m_center.x = pPosX[i];
+			ballData.m_center.y = pPosY[i];
+			ballData.m_radius	= pRadius[i];
+
+			// Check collision with the walls and pillars near the ball's path only
+			CageSimWallCandidates(sim, ballData, posNext, candidates);
+
+			size_t j = 0;
+			while (j < candidates.size()) {
+				unsigned int wallIdx = candidates[j++];
+				++testNum;
+
+				if (CollideObstacle(sim, wallIdx, ballData, posNext, pVelX[i], pVelY[i],
+					interPtA, normalAtCollision, interTime))
+				{
+					if (!ReflectBall(interPtA, normalAtCollision, pSpeed[i], posNext, pVelX[i], pVelY[i]))
+						break;
+
+					// posNext was reflected and may now reach walls the first
+					// query did not return: query again and carry on with the
+					// walls that come after this one
+					CageSimWallCandidates(sim, ballData, posNext, candidates);
+					j = std::upper_bound(candidates.begin(), candidates.end(), wallIdx) - candidates.begin();
+				}
+			}
+
+			pPosX[i] = posNext.x;
+			pPosY[i] = posNext.y;
+		}
+
+		wallTestNum += testNum;
+	}
+
+	/**************************************************************************/
+	/*!
+		Finds the wall or pillar a ball moving at velX, velY hits first on
+		its way from ballData.m_center to ptEnd, skipping skipWallIdx.
+		Returns its index, m_obstacleNum if none, with the impact time
+		(fraction of the path), point and normal
+	 */
+	/**************************************************************************/
+	unsigned int FindFirstImpact(const CageSimulation &sim, const Circle &ballData, const CSD1130::Vec2 &ptEnd,
+		float velX, float velY, unsigned int skipWallIdx,
+		std::vector<unsigned int> &candidates, unsigned long long &testNum,
+		float &hitTime, CSD1130::Vec2 &hitPt, CSD1130::Vec2 &hitNormal)
+	{
+		CSD1130::Vec2	interPtA;
+		CSD1130::Vec2	normalAtCollision;
+		float			interTime = 0.0f;
+
+		unsigned int hitWallIdx = sim.m_obstacleNum;
+		hitTime = 2.0f;
+
+		CageSimWallCandidates(sim, ballData, ptEnd, candidates);
+		testNum += candidates.size();
+
+		for (size_t j = 0; j < candidates.size(); ++j) {
+			unsigned int wallIdx = candidates[j];
+			if (wallIdx == skipWallIdx)
+				continue;
+
+			if (CollideObstacle(sim, wallIdx, ballData, ptEnd, velX, velY,
+					interPtA, normalAtCollision, interTime) &&
+				interTime >= 0.0f && interTime < hitTime)
+			{
+				hitWallIdx	= wallIdx;
+				hitTime		= interTime;
+				hitPt		= interPtA;
+				hitNormal	= normalAtCollision;
+			}
+		}
+
+		return hitWallIdx;
+	}
+
+	/**************************************************************************/
+	/*!
+		Moves the balls [begin, end) to their integrated position, each one
+		reflecting on the wall or pillar it hits first, then going on from the
+		impact with the rest of its path. Only those balls are written,
+		candidates is the scratch buffer of the calling worker
+	 */
+	/**************************************************************************/
+	void CollideBallsContinuous(CageSimulation &sim, unsigned int begin, unsigned int end,
+		std::vector<unsigned int> &candidates, unsigned long long &wallTestNum)
+	{
+		BallStore &balls = sim.m_balls;
+		float *pPosX			= balls.m_posX.data();
+		float *pPosY			= balls.m_posY.data();
+		float *pVelX			= balls.m_velX.data();
+		float *pVelY			= balls.m_velY.data();
+		const float *pRadius	= balls.m_radius.data();
+		const float *pSpeed		= balls.m_speed.data();
+		const float *pNextX		= sim.m_posNextX.data();
+		const float *pNextY		= sim.m_posNextY.data();
+
+		unsigned long long testNum = 0;
+
+		for (unsigned int i = begin; i < end; ++i) {
+			CSD1130::Vec2 posNext;
+			posNext.x = pNextX[i];
+			posNext.y = pNextY[i];
+
+			// Start of the part of the path left to travel
+			Circle ballData;
+			ballData.m_center.x = pPosX[i];
+			ballData.m_center.y = pPosY[i];
+			ballData.m_radius	= pRadius[i];
+
+			// The wall just hit is skipped on the next bounce: the ball
+			// starts touching it, so it would be found again at time 0
+			unsigned int lastWallIdx = sim.m_obstacleNum;
+
+			for (unsigned int bounce = 0; bounce < CAGE_SIM_BOUNCE_MAX; ++bounce) {
+				float hitTime;
+				CSD1130::Vec2 hitPt, hitNormal;
+
+				unsigned int hitWallIdx = FindFirstImpact(sim, ballData, posNext, pVelX[i], pVelY[i], lastWallIdx,
+					candidates, testNum, hitTime, hitPt, hitNormal);
+
+				if (hitWallIdx == sim.m_obstacleNum)
+					break;
+
+				// Reflects what is left of the path about the wall, so
+				// posNext is where the rest of the time budget leads
+				if (!ReflectBall(hitPt, hitNormal, pSpeed[i], posNext, pVelX[i], pVelY[i]))
+					break;
+
+				// Out of bounces: stop at the impact rather than risk
+				// going through the next wall
+				if (bounce + 1 == CAGE_SIM_BOUNCE_MAX)
+					posNext = hitPt;
+
+				ballData.m_center	= hitPt;
+				lastWallIdx			= hitWallIdx;
+			}
+
+			pPosX[i] = posNext.x;
+			pPosY[i] = posNext.y;
+		}
+
+		wallTestNum += testNum;
+	}
+
+	void CollideBalls(CageSimulation &sim, unsigned int begin, unsigned int end,
+		std::vector<unsigned int> &candidates, unsigned long long &wallTestNum)
+	{
+		if (sim.m_collision == 1)
+			CollideBallsContinuous(sim, begin, end, candidates, wallTestNum);
+		else
+			CollideBallsInOrder(sim, begin, end, candidates, wallTestNum);
+	}
+
+	/**************************************************************************/
+	/*!
+		Finds the next impact of ball i from its last one and queues it.
+		A ball that hits nothing within CAGE_SIM_EVENT_HORIZON is queued
+		at the end of it, with no wall, to be looked at again
+	 */
+	/**************************************************************************/
+	void ScheduleBallEvent(CageSimulation &sim, unsigned int i,
+		std::vector<unsigned int> &candidates, unsigned long long &wallTestNum)
+	{
+		const BallStore &balls = sim.m_balls;
+		float velX = balls.m_velX[i], velY = balls.m_velY[i];
+
+		Circle ballData;
+		ballData.m_center.x = sim.m_eventPosX[i];
+		ballData.m_center.y = sim.m_eventPosY[i];
+		ballData.m_radius	= balls.m_radius[i];
+
+		CSD1130::Vec2 ptEnd(ballData.m_center.x + velX * CAGE_SIM_EVENT_HORIZON,
+							ballData.m_center.y + velY * CAGE_SIM_EVENT_HORIZON);
+
+		float hitTime;
+		CSD1130::Vec2 hitPt, hitNormal;
+
+		unsigned int hitWallIdx = FindFirstImpact(sim, ballData, ptEnd, velX, velY, sim.m_eventLastWall[i],
+			candidates, wallTestNum, hitTime, hitPt, hitNormal);
+
+		CageSimEvent event;
+		event.m_ballIdx	= i;
+		event.m_time	= sim.m_eventTime[i] + (hitWallIdx == sim.m_obstacleNum ? 1.0f : hitTime) * CAGE_SIM_EVENT_HORIZON;
+
+		sim.m_eventNextTime[i]		= event.m_time;
+		sim.m_eventNextWall[i]		= hitWallIdx;
+		sim.m_eventNormalX[i]		= hitNormal.x;
+		sim.m_eventNormalY[i]		= hitNormal.y;
+		sim.m_events.push(event);
+	}
+
+	/**************************************************************************/
+	/*!
+		Moves every ball whose impact is due by time to its impact,
+		reflects it and queues its next impact, in time order. At most
+		maxEventNum impacts are handled, the others wait for the next call
+	 */
+	/**************************************************************************/
+	void ProcessBallEvents(CageSimulation &sim, double time, unsigned int maxEventNum,
+		std::vector<unsigned int> &candidates, unsigned long long &wallTestNum)
+	{
+		BallStore &balls = sim.m_balls;
+
+		for (unsigned int eventNum = 0; eventNum < maxEventNum && !sim.m_events.empty(); ++eventNum) {
+			CageSimEvent event = sim.m_events.top();
+			if (event.m_time > time)
+				break;
+			sim.m_events.pop();
+
+			unsigned int i = event.m_ballIdx;
+			float elapsed = (float)(event.m_time - sim.m_eventTime[i]);
+
+			CSD1130::Vec2 pos(sim.m_eventPosX[i] + balls.m_velX[i] * elapsed,
+							  sim.m_eventPosY[i] + balls.m_velY[i] * elapsed);
+
+			if (sim.m_eventNextWall[i] != sim.m_obstacleNum) {
+				CSD1130::Vec2 normal(sim.m_eventNormalX[i], sim.m_eventNormalY[i]);
+				CSD1130::Vec2 ptEnd(pos.x + balls.m_velX[i], pos.y + balls.m_velY[i]);
+				CSD1130::Vec2 reflectedVec;
+
+				CollisionResponse_CircleLineSegment(pos,
+					normal,
+					ptEnd,
+					reflectedVec);
+
+				balls.m_velX[i] = reflectedVec.x * balls.m_speed[i];
+				balls.m_velY[i] = reflectedVec.y * balls.m_speed[i];
+				sim.m_eventLastWall[i] = sim.m_eventNextWall[i];
+			}
+
+			sim.m_eventPosX[i]	= pos.x;
+			sim.m_eventPosY[i]	= pos.y;
+			sim.m_eventTime[i]	= event.m_time;
+
+			ScheduleBallEvent(sim, i, candidates, wallTestNum);
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		Places the balls [begin, end) where their last impact leads them
+		at the current simulation time. A ball whose next impact is due
+		but was left for the next step, when a step had too many, waits
+		at that impact instead of going through the wall
+	 */
+	/**************************************************************************/
+	void ExtrapolateBalls(CageSimulation &sim, unsigned int begin, unsigned int end)
+	{
+		BallStore &balls = sim.m_balls;
+		float *pPosX			= balls.m_posX.data();
+		float *pPosY			= balls.m_posY.data();
+		const float *pVelX		= balls.m_velX.data();
+		const float *pVelY		= balls.m_velY.data();
+		const float *pEventX	= sim.m_eventPosX.data();
+		const float *pEventY	= sim.m_eventPosY.data();
+		const double *pTime		= sim.m_eventTime.data();
+		const double *pNextTime	= sim.m_eventNextTime.data();
+
+		for (unsigned int i = begin; i < end; ++i) {
+			float elapsed = (float)(std::min(sim.m_time, pNextTime[i]) - pTime[i]);
+			pPosX[i] = pEventX[i] + pVelX[i] * elapsed;
+			pPosY[i] = pEventY[i] + pVelY[i] * elapsed;
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		Bounces the balls that touch each other at the end of the step.
+		Pairs are taken in sweep order, a ball in several pairs sees the
+		velocity left by the earlier ones
+	 */
+	/**************************************************************************/
+	void CollideBallPairs(CageSimulation &sim)
+	{
+		BallStore &balls = sim.m_balls;
+
+		SweepAndPruneUpdate(sim.m_ballSAP, balls.m_posX.data(), balls.m_posY.data(), balls.m_radius.data(), balls.m_count);
+		SweepAndPruneFindPairs(sim.m_ballSAP, sim.m_ballPairs);
+		sim.m_ballTestNum += sim.m_ballPairs.size() / 2;
+
+		CSD1130::Vec2 normal;
+
+		for (size_t p = 0; p + 1 < sim.m_ballPairs.size(); p += 2) {
+			unsigned int i0 = sim.m_ballPairs[p], i1 = sim.m_ballPairs[p + 1];
+
+			Circle ball0, ball1;
+			ball0.m_center = CSD1130::Vec2(balls.m_posX[i0], balls.m_posY[i0]);
+			ball0.m_radius = balls.m_radius[i0];
+			ball1.m_center = CSD1130::Vec2(balls.m_posX[i1], balls.m_posY[i1]);
+			ball1.m_radius = balls.m_radius[i1];
+
+			if (!CollisionIntersection_CircleCircle(ball0, ball1, normal))
+				continue;
+
+			CSD1130::Vec2 vel0(balls.m_velX[i0], balls.m_velY[i0]);
+			CSD1130::Vec2 vel1(balls.m_velX[i1], balls.m_velY[i1]);
+
+			CollisionResponse_CircleCircle(normal, vel0, vel1);
+
+			balls.m_velX[i0] = vel0.x;
+			balls.m_velY[i0] = vel0.y;
+			balls.m_velX[i1] = vel1.x;
+			balls.m_velY[i1] = vel1.y;
+		}
+	}
+
+	void IntegrateBallsJob(void *pUserData, unsigned int begin, unsigned int end, unsigned int)
+	{
+		StepJobData &data = *(StepJobData *)pUserData;
+		IntegrateBalls(*data.pSim, data.dt, begin, end);
+	}
+
+	void CollideBallsJob(void *pUserData, unsigned int begin, unsigned int end, unsigned int workerIdx)
+	{
+		StepJobData &data = *(StepJobData *)pUserData;
+		CollideBalls(*data.pSim, begin, end, data.pSim->m_wallCandidates[workerIdx], data.pSim->m_wallTestNum[workerIdx]);
+	}
+
+	void ExtrapolateBallsJob(void *pUserData, unsigned int begin, unsigned int end, unsigned int)
+	{
+		StepJobData &data = *(StepJobData *)pUserData;
+		ExtrapolateBalls(*data.pSim, begin, end);
+	}
+
+	/**************************************************************************/
+	/*!
+		Copies the balls out of the level and, in the event driven mode,
+		finds the first impact of each one. The walls, their broadphase
+		and the scratch buffers of the first worker must be set
+	 */
+	/**************************************************************************/
+	void StartBalls(CageSimulation &sim, const LevelBinary &level)
+	{
+		// balls move, so they are copied out of the level
+		BallStoreReserve(sim.m_balls, level.m_ballNum);
+
+		for (unsigned int i = 0; i < level.m_ballNum; ++i)
+			BallStoreAdd(sim.m_balls, level.m_pBalls[i].m_center, level.m_pBallVel[i], level.m_pBalls[i].m_radius, level.m_pBallSpeed[i]);
+
+		// every ball starts with an impact to find
+		if (sim.m_collision == 2) {
+			unsigned int ballNum = sim.m_balls.m_count;
+			sim.m_eventPosX		= sim.m_balls.m_posX;
+			sim.m_eventPosY		= sim.m_balls.m_posY;
+			sim.m_eventTime.assign(ballNum, 0.0);
+			sim.m_eventLastWall.assign(ballNum, sim.m_obstacleNum);
+			sim.m_eventNextTime.assign(ballNum, 0.0);
+			sim.m_eventNextWall.assign(ballNum, sim.m_obstacleNum);
+			sim.m_eventNormalX.assign(ballNum, 0.0f);
+			sim.m_eventNormalY.assign(ballNum, 0.0f);
+
+			for (unsigned int i = 0; i < ballNum; ++i)
+				ScheduleBallEvent(sim, i, sim.m_wallCandidates[0], sim.m_wallTestNum[0]);
+		}
+	}
+
+	/**************************************************************************/
+	/*!
+		Removes the balls and what the steps kept about them, but keeps
+		the memory of every buffer for the next run of the level
+	 */
+	/**************************************************************************/
+	void StopBalls(CageSimulation &sim)
+	{
+		BallStoreRemoveAll(sim.m_balls);
+
+		// no entry makes the next update sort the balls from scratch
+		sim.m_ballSAP.m_entries.clear();
+		sim.m_ballSAP.m_swapNum = 0;
+		sim.m_ballPairs.clear();
+		sim.m_ballTestNum = 0;
+		sim.m_wallTestNum.assign(sim.m_wallTestNum.size(), 0);
+
+		sim.m_time = 0.0;
+		sim.m_eventPosX.clear();
+		sim.m_eventPosY.clear();
+		sim.m_eventTime.clear();
+		sim.m_eventLastWall.clear();
+		sim.m_eventNextTime.clear();
+		sim.m_eventNextWall.clear();
+		sim.m_eventNormalX.clear();
+		sim.m_eventNormalY.clear();
+		sim.m_events = std::priority_queue<CageSimEvent, std::vector<CageSimEvent>, std::greater<CageSimEvent>>();
+		sim.m_frameTimeLeft = 0.0;
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Creates the balls of a compiled level, uses its walls and pillars
+		 in place and builds their broadphase.
+*
+* \param [out]	sim				Reference to CageSimulation to be set.
+*
+* \param [in]	level			Const reference to the compiled level. It must
+								stay open while sim uses it.
+*
+* \param [in]	broadphase		0: uniform grid, 1: bounding volume hierarchy.
+*
+* \param [in]	collision		0: walls in index order, 1: continuous
+								collision, earliest impact first, 2: event
+								driven.
+*
+* \param [in]	checkLineEdges	Flag to determine whether balls collide with
+								the line segment edges.
+*
+* \param [in]	ballCollision	Flag to determine whether balls collide with
+								each other. Ignored in the event driven mode.
+ */
+/******************************************************************************/
+void CageSimInit(CageSimulation &sim,
+	const LevelBinary &level,
+	int broadphase,
+	int collision,
+	bool checkLineEdges,
+	bool ballCollision)
+{
+	CageSimClear(sim);
+
+	sim.m_broadphase		= broadphase;
+	sim.m_collision			= collision;
+	sim.m_checkLineEdges	= checkLineEdges;
+	sim.m_ballCollision		= ballCollision && collision != 2;
+
+	// walls and pillars never move, so the broadphase is built once per level
+	sim.m_pWalls		= level.m_pWalls;
+	sim.m_wallNum		= level.m_wallNum;
+	sim.m_pPillars		= level.m_pPillars;
+	sim.m_pillarNum		= level.m_pillarNum;
+	sim.m_obstacleNum	= sim.m_wallNum + sim.m_pillarNum;
+
+	if (sim.m_broadphase == 0)
+		SpatialGridBuild(sim.m_wallGrid, sim.m_pWalls, sim.m_wallNum, sim.m_pPillars, sim.m_pillarNum);
+	else
+		StaticBVHBuild(sim.m_wallBVH, sim.m_pWalls, sim.m_wallNum, sim.m_pPillars, sim.m_pillarNum);
+
+	sim.m_wallCandidates.resize(1);
+	sim.m_wallTestNum.assign(1, 0);
+
+	StartBalls(sim, level);
+}
+
+/******************************************************************************/
+/*!
+* \brief Puts the balls back where the level starts them, as CageSimInit
+		 would, but keeps the broadphase of the walls and pillars, which
+		 never move, and the memory of every buffer, so that a restart
+		 does not allocate.
+*
+* \param [in,out]	sim			Reference to the CageSimulation, set by
+								CageSimInit with the same level.
+*
+* \param [in]		level		Const reference to the compiled level.
+ */
+/******************************************************************************/
+void CageSimRestart(CageSimulation &sim,
+	const LevelBinary &level)
+{
+	StopBalls(sim);
+	StartBalls(sim, level);
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes a ball by moving the last ball into its slot, like
+		 BallStoreRemove, and keeps what the simulation stores per ball in
+		 step: in the event driven mode, the last impact of the ball and
+		 its queued next impact move with it.
+*
+* \param [in,out]	sim			Reference to the CageSimulation.
+*
+* \param [in]		ballIdx		Index of the ball to remove.
+*
+  \return			unsigned int	Previous index of the ball that now lives
+									at ballIdx. Equal to ballIdx when the
+									removed ball was the last one.
+ */
+/******************************************************************************/
+unsigned int CageSimRemoveBall(CageSimulation &sim,
+	unsigned int ballIdx)
+{
+	unsigned int last = BallStoreRemove(sim.m_balls, ballIdx);
+
+	if (sim.m_collision != 2)
+		return last;
+
+	sim.m_eventPosX[ballIdx]		= sim.m_eventPosX[last];
+	sim.m_eventPosY[ballIdx]		= sim.m_eventPosY[last];
+	sim.m_eventTime[ballIdx]		= sim.m_eventTime[last];
+	sim.m_eventLastWall[ballIdx]	= sim.m_eventLastWall[last];
+	sim.m_eventNextTime[ballIdx]	= sim.m_eventNextTime[last];
+	sim.m_eventNextWall[ballIdx]	= sim.m_eventNextWall[last];
+	sim.m_eventNormalX[ballIdx]		= sim.m_eventNormalX[last];
+	sim.m_eventNormalY[ballIdx]		= sim.m_eventNormalY[last];
+
+	sim.m_eventPosX.pop_back();
+	sim.m_eventPosY.pop_back();
+	sim.m_eventTime.pop_back();
+	sim.m_eventLastWall.pop_back();
+	sim.m_eventNextTime.pop_back();
+	sim.m_eventNextWall.pop_back();
+	sim.m_eventNormalX.pop_back();
+	sim.m_eventNormalY.pop_back();
+
+	// the queue holds one impact per ball and cannot be edited in place:
+	// drop the impact of the removed ball, renumber the one of the moved
+	// ball and queue them all again
+	std::vector<CageSimEvent> events;
+	events.reserve(sim.m_events.size());
+
+	for (; !sim.m_events.empty(); sim.m_events.pop()) {
+		CageSimEvent event = sim.m_events.top();
+		if (event.m_ballIdx == ballIdx)
+			continue;
+		if (event.m_ballIdx == last)
+			event.m_ballIdx = ballIdx;
+		events.push_back(event);
+	}
+
+	for (size_t i = 0; i < events.size(); ++i)
+		sim.m_events.push(events[i]);
+
+	return last;
+}
+
+/******************************************************************************/
+/*!
+* \brief Moves every ball by dt, reflecting it on the walls it hits: first
+		 integrates every ball, then checks each path against the walls,
+		 then bounces the balls that touch each other.
+		 In the event driven mode, handles the impacts due by the end of
+		 the step, then extrapolates every ball from its last impact.
+*
+* \param [in,out]	sim			Reference to the CageSimulation.
+*
+* \param [in]		dt			Time step.
+*
+* \param [in]		pJobs		Workers to split the balls over, NULL to step
+								them on the calling thread only.
+ */
+/******************************************************************************/
+void CageSimStep(CageSimulation &sim,
+	float dt,
+	JobSystem *pJobs)
+{
+	unsigned int ballNum = sim.m_balls.m_count;
+	unsigned int workerNum = pJobs ? JobSystemWorkerNum(*pJobs) : 1;
+	if (workerNum == 0)
+		workerNum = 1;
+	if (sim.m_wallCandidates.size() < workerNum)
+		sim.m_wallCandidates.resize(workerNum);
+	if (sim.m_wallTestNum.size() < workerNum)
+		sim.m_wallTestNum.resize(workerNum, 0);
+
+	StepJobData data;
+	data.pSim	= &sim;
+	data.dt		= dt;
+
+	if (sim.m_collision == 2) {
+		sim.m_time += dt;
+
+		{
+			// the queue is shared, so impacts are handled on this thread
+			PROFILE_SCOPE("Events");
+			ProcessBallEvents(sim, sim.m_time, ballNum * CAGE_SIM_BOUNCE_MAX, sim.m_wallCandidates[0], sim.m_wallTestNum[0]);
+		}
+		{
+			PROFILE_SCOPE("Extrapolate");
+			if (workerNum == 1)
+				ExtrapolateBalls(sim, 0, ballNum);
+			else
+				JobSystemParallelFor(*pJobs, 0, ballNum, BALL_CHUNK_NUM * 16, ExtrapolateBallsJob, &data);
+		}
+		return;
+	}
+
+	if (sim.m_posNextX.size() < ballNum) {
+		sim.m_posNextX.resize(ballNum);
+		sim.m_posNextY.resize(ballNum);
+	}
+
+	if (workerNum == 1) {
+		{
+			PROFILE_SCOPE("Integrate");
+			IntegrateBalls(sim, dt, 0, ballNum);
+		}
+		{
+			PROFILE_SCOPE("Collide");
+			CollideBalls(sim, 0, ballNum, sim.m_wallCandidates[0], sim.m_wallTestNum[0]);
+		}
+	}
+	else {
+		{
+			PROFILE_SCOPE("Integrate");
+			JobSystemParallelFor(*pJobs, 0, ballNum, BALL_CHUNK_NUM * 16, IntegrateBallsJob, &data);
+		}
+		{
+			PROFILE_SCOPE("Collide");
+			JobSystemParallelFor(*pJobs, 0, ballNum, BALL_CHUNK_NUM, CollideBallsJob, &data);
+		}
+	}
+
+	if (sim.m_ballCollision) {
+		PROFILE_SCOPE("Balls");
+		CollideBallPairs(sim);
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Adds the time of a frame to the time left to simulate, and steps
+		 the balls by stepDt as long as a whole step is left, at most
+		 stepMax times. What a slow frame leaves beyond that is dropped.
+		 The positions before the last step are kept in the BallStore, so
+		 the balls can be drawn between the last two steps.
+*
+* \param [in,out]	sim			Reference to the CageSimulation.
+*
+* \param [in]		frameDt		Time of the frame.
+*
+* \param [in]		stepDt		Fixed time step.
+*
+* \param [in]		stepMax		Most steps for this frame.
+*
+* \param [in]		pJobs		Workers to split the balls over, NULL to step
+								them on the calling thread only.
+*
+  \return			unsigned int	Number of steps taken.
+ */
+/******************************************************************************/
+unsigned int CageSimAdvance(CageSimulation &sim,
+	float frameDt,
+	float stepDt,
+	unsigned int stepMax,
+	JobSystem *pJobs)
+{
+	sim.m_frameTimeLeft += frameDt;
+
+	unsigned int stepNum = 0;
+	while (sim.m_frameTimeLeft >= stepDt && stepNum < stepMax) {
+		BallStoreSavePositions(sim.m_balls);
+		CageSimStep(sim, stepDt, pJobs);
+		sim.m_frameTimeLeft -= stepDt;
+		++stepNum;
+	}
+
+	if (sim.m_frameTimeLeft >= stepDt)
+		sim.m_frameTimeLeft = 0.0;
+
+	return stepNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Collects the walls and pillars a ball may hit moving from its
+		 center to ptEnd.
+*
+* \param [in]	sim				Const reference to the CageSimulation.
+*
+* \param [in]	ball			Const reference to Circle containing
+								start pos of the ball and its radius.
+*
+* \param [in]	ptEnd			Const reference to CSD1130::Vec2 containing
+								end pos of the ball.
+*
+* \param [out]	result			Cleared, then filled with the candidate
+								indices in increasing order: walls, then
+								pillar i as m_wallNum + i.
+ */
+/******************************************************************************/
+void CageSimWallCandidates(const CageSimulation &sim,
+	const Circle &ball,
+	const CSD1130::Vec2 &ptEnd,
+	std::vector<unsigned int> &result)
+{
+	if (sim.m_broadphase == 0) {
+		AABB sweptAABB;
+		BuildAABB(sweptAABB, ball, ptEnd);
+		SpatialGridQuery(sim.m_wallGrid, sweptAABB, result);
+	}
+	else
+		StaticBVHQuery(sim.m_wallBVH, ball, ptEnd, result);
+}
+
+/******************************************************************************/
+/*!
+* \brief Counts the ball-vs-wall tests made since CageSimInit, that is the
+		 wall and pillar candidates returned by the broadphase.
+*
+* \param [in]	sim				Const reference to the CageSimulation.
+*
+  \return		unsigned long long	number of tests.
+ */
+/******************************************************************************/
+unsigned long long CageSimWallTestNum(const CageSimulation &sim)
+{
+	unsigned long long testNum = 0;
+	for (size_t i = 0; i < sim.m_wallTestNum.size(); ++i)
+		testNum += sim.m_wallTestNum[i];
+	return testNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Counts the ball-vs-ball tests made since CageSimInit, that is the
+		 pairs returned by the broadphase.
+*
+* \param [in]	sim				Const reference to the CageSimulation.
+*
+  \return		unsigned long long	number of tests.
+ */
+/******************************************************************************/
+unsigned long long CageSimBallTestNum(const CageSimulation &sim)
+{
+	return sim.m_ballTestNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Removes every ball, wall and pillar and releases the broadphase.
+*
+* \param [in,out]	sim			Reference to the CageSimulation.
+ */
+/******************************************************************************/
+void CageSimClear(CageSimulation &sim)
+{
+	BallStoreClear(sim.m_balls);
+	sim.m_pWalls		= NULL;
+	sim.m_wallNum		= 0;
+	sim.m_pPillars		= NULL;
+	sim.m_pillarNum		= 0;
+	sim.m_obstacleNum	= 0;
+	SpatialGridClear(sim.m_wallGrid);
+	StaticBVHClear(sim.m_wallBVH);
+
+	SweepAndPruneClear(sim.m_ballSAP);
+	sim.m_ballPairs.clear();
+	sim.m_ballTestNum = 0;
+	sim.m_wallTestNum.clear();
+	sim.m_time = 0.0;
+	sim.m_eventPosX.clear();
+	sim.m_eventPosY.clear();
+	sim.m_eventTime.clear();
+	sim.m_eventLastWall.clear();
+	sim.m_eventNextTime.clear();
+	sim.m_eventNextWall.clear();
+	sim.m_eventNormalX.clear();
+	sim.m_eventNormalY.clear();
+	sim.m_events = std::priority_queue<CageSimEvent, std::vector<CageSimEvent>, std::greater<CageSimEvent>>();
+	sim.m_frameTimeLeft = 0.0;
+}
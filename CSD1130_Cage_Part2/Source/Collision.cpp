@@ -5,9 +5,12 @@
 \par    	email: yiming.guo@digipen.edu
 \date   	Mar 18, 2023
 \brief		This source file contains definitions for BuildLineSegment,
+			BuildAABB, AABBOverlap,
 			CollisionIntersection_CircleLineSegment,
-			CheckMovingCircleToLineEdge and
-			CollisionResponse_CircleLineSegment.
+			CheckMovingCircleToLineEdge, CollisionIntersection_CircleCircle,
+			CollisionIntersection_MovingCircleCircle,
+			CollisionResponse_CircleLineSegment and
+			CollisionResponse_CircleCircle.
 
 Copyright (C) 2023 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -15,11 +18,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
  */
 /******************************************************************************/
 
-#include "main.h"
+#include "Collision.h"
+#include <cmath>
 
 /******************************************************************************/
 /*!
-* \brief Builds a line segment
+* \brief Builds a line segment and its collision constants
 * \param [out]	lineSegment		Reference to LineSegment to be set.
 * 
 * \param [in]	p0				Const reference to CSD1130::Vec2 for input.
@@ -39,8 +43,89 @@ void BuildLineSegment(LineSegment &lineSegment,
 	CSD1130::Vec2 dir = p1 - p0;
 
 	// Calculate the outward-facing normal of the line segment
-	// Set the normal of the line segment
-	CSD1130::Vector2DNormalize(lineSegment.m_normal, CSD1130::Vector2D(dir.y, -dir.x));
+	// Set the normal of the line segment, always exactly so that the walls
+	// (and the compiled levels) do not depend on CSD1130_FAST_NORMALIZE
+	CSD1130::Vector2DNormalizeExact(lineSegment.m_normal, CSD1130::Vector2D(dir.y, -dir.x));
+
+	// Constants of the collision tests, the same for every ball
+	lineSegment.m_length	= CSD1130::Vector2DLength(dir);
+	lineSegment.m_invLength	= lineSegment.m_length > 0.0f ? 1.0f / lineSegment.m_length : 0.0f;
+	lineSegment.m_dir		= dir * lineSegment.m_invLength;
+	lineSegment.m_NP0		= CSD1130::Vector2DDotProduct(lineSegment.m_normal, p0);
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the bounding box of a line segment
+* \param [out]	aabb			Reference to AABB to be set.
+* 
+* \param [in]	lineSeg			Const reference to LineSegment for input.
+ */
+/******************************************************************************/
+void BuildAABB(AABB &aabb,
+	const LineSegment &lineSeg)
+{
+	aabb.m_min.x = fminf(lineSeg.m_pt0.x, lineSeg.m_pt1.x);
+	aabb.m_min.y = fminf(lineSeg.m_pt0.y, lineSeg.m_pt1.y);
+	aabb.m_max.x = fmaxf(lineSeg.m_pt0.x, lineSeg.m_pt1.x);
+	aabb.m_max.y = fmaxf(lineSeg.m_pt0.y, lineSeg.m_pt1.y);
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the bounding box of a circle
+* \param [out]	aabb			Reference to AABB to be set.
+* 
+* \param [in]	circle			Const reference to Circle for input.
+ */
+/******************************************************************************/
+void BuildAABB(AABB &aabb,
+	const Circle &circle)
+{
+	aabb.m_min.x = circle.m_center.x - circle.m_radius;
+	aabb.m_min.y = circle.m_center.y - circle.m_radius;
+	aabb.m_max.x = circle.m_center.x + circle.m_radius;
+	aabb.m_max.y = circle.m_center.y + circle.m_radius;
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the bounding box swept by a circle moving from its center
+		 to ptEnd.
+* \param [out]	aabb			Reference to AABB to be set.
+* 
+* \param [in]	circle			Const reference to Circle containing
+								start pos of the circle and its radius.
+* 
+* \param [in]	ptEnd			Const reference to CSD1130::Vec2 containing
+								end pos of the circle.
+ */
+/******************************************************************************/
+void BuildAABB(AABB &aabb,
+	const Circle &circle,
+	const CSD1130::Vec2 &ptEnd)
+{
+	aabb.m_min.x = fminf(circle.m_center.x, ptEnd.x) - circle.m_radius;
+	aabb.m_min.y = fminf(circle.m_center.y, ptEnd.y) - circle.m_radius;
+	aabb.m_max.x = fmaxf(circle.m_center.x, ptEnd.x) + circle.m_radius;
+	aabb.m_max.y = fmaxf(circle.m_center.y, ptEnd.y) + circle.m_radius;
+}
+
+/******************************************************************************/
+/*!
+* \brief Checks whether two bounding boxes overlap (touching counts).
+* \param [in]	aabb0			Const reference to the first AABB.
+* 
+* \param [in]	aabb1			Const reference to the second AABB.
+* 
+  \return		bool			returns true if the boxes overlap.
+ */
+/******************************************************************************/
+bool AABBOverlap(const AABB &aabb0,
+	const AABB &aabb1)
+{
+	return	aabb0.m_min.x <= aabb1.m_max.x && aabb1.m_min.x <= aabb0.m_max.x &&
+			aabb0.m_min.y <= aabb1.m_max.y && aabb1.m_min.y <= aabb0.m_max.y;
 }
 
 /******************************************************************************/
@@ -83,38 +168,33 @@ int CollisionIntersection_CircleLineSegment(const Circle &circle,
 	CSD1130::Vec2 V = ptEnd - circle.m_center;
 	CSD1130::Vec2 M(V.y, -V.x);
 
-	// Calculate N.Bs, N.P0, N.Bs & N.V
+	// Calculate N.Bs & N.V, N.P0 comes with the line segment
 	float			NBs = CSD1130::Vector2DDotProduct(lineSeg.m_normal, circle.m_center),
-					NP0 = CSD1130::Vector2DDotProduct(lineSeg.m_normal, lineSeg.m_pt0),
+					NP0 = lineSeg.m_NP0,
 					NV	= CSD1130::Vector2DDotProduct(lineSeg.m_normal, V);
 
-	// For calculations later simulating LNS1 and LNS2
-	CSD1130::Vec2	P0prime,
-					P1prime,
-					BsP0prime,
-					BsP1prime;
+	// For calculations later simulating LNS1 and LNS2: their edge points
+	// are P0' = P0 -/+ R.N and P1' = P0' + L.D (D the unit direction, L
+	// the length). As M.N = V.D and M.D = -N.V, the M.BsP0' and M.BsP1'
+	// needed below follow from M.BsP0 without computing P0' and P1'
+	CSD1130::Vec2	BsP0 = lineSeg.m_pt0 - circle.m_center;
 
-	float			MBsP0prime,
+	float			MBsP0 = CSD1130::Vector2DDotProduct(M, BsP0),
+					RVD = circle.m_radius * CSD1130::Vector2DDotProduct(V, lineSeg.m_dir),
+					LNV = lineSeg.m_length * NV,
+					MBsP0prime,
 					MBsP1prime;
 
 	// Bs is starting from the inside half plane, and away from LNS by at least R
 	// Here we consider we have an imaginary line LNS1, distant by -R (opposite N direction)
 	if (NBs - NP0 <= -circle.m_radius) {
 		// Check if the velocity vector V is within the end points of LNS1
-		// M is the outward normal to velocity. Compute P0' and P1'
-		// To simulate LNS1 line edge points
-
-		// Calculate P0' and P1'
-		P0prime = lineSeg.m_pt0 - circle.m_radius * lineSeg.m_normal;
-		P1prime = lineSeg.m_pt1 - circle.m_radius * lineSeg.m_normal;
+		// M is the outward normal to velocity. P0' and P1' simulate
+		// LNS1 line edge points
 
-		// Calculate BsP0' and BsP1'
-		BsP0prime = P0prime - circle.m_center;
-		BsP1prime = P1prime - circle.m_center;
-
-		// Calculate M.BsP0'& M.BsP1'
-		MBsP0prime = CSD1130::Vector2DDotProduct(M, BsP0prime);
-		MBsP1prime = CSD1130::Vector2DDotProduct(M, BsP1prime);
+		// Calculate M.BsP0'& M.BsP1', with P0' = P0 - R.N
+		MBsP0prime = MBsP0 - RVD;
+		MBsP1prime = MBsP0prime - LNV;
 
 		if (MBsP0prime * MBsP1prime < 0) {
 			interTime = (NP0 - NBs - circle.m_radius) / (NV);				// We are sure N.V != 0
@@ -132,19 +212,12 @@ int CollisionIntersection_CircleLineSegment(const Circle &circle,
 	// Here we consider we have an imaginary line LNS2 distant by +R (Same N direction)
 	else if (NBs - NP0 >= circle.m_radius) {
 		// Check if the velocity vector V is within the end points of LNS2
-		// M is the outward normal to Velocity V. Compute P0' and P1'
-
-		// Calculate P0' and P1'
-		P0prime = lineSeg.m_pt0 + circle.m_radius * lineSeg.m_normal;
-		P1prime = lineSeg.m_pt1 + circle.m_radius * lineSeg.m_normal;
-
-		// Calculate BsP0' and BsP1'
-		BsP0prime = P0prime - circle.m_center;
-		BsP1prime = P1prime - circle.m_center;
+		// M is the outward normal to Velocity V. P0' and P1' simulate
+		// LNS2 line edge points
 
-		// Calculate M.BsP0'& M.BsP1'
-		MBsP0prime = CSD1130::Vector2DDotProduct(M, BsP0prime);
-		MBsP1prime = CSD1130::Vector2DDotProduct(M, BsP1prime);
+		// Calculate M.BsP0'& M.BsP1', with P0' = P0 + R.N
+		MBsP0prime = MBsP0 + RVD;
+		MBsP1prime = MBsP0prime - LNV;
 
 		if (MBsP0prime * MBsP1prime < 0) {
 			interTime = (NP0 - NBs + circle.m_radius) / (NV);				// We are sure N.V != 0
@@ -200,18 +273,18 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 	CSD1130::Vec2 &normalAtCollision,
 	float &interTime)
 {
-	// Bs = circle.center
+	// Bs = circle.center, only the sign of BsP0.P0P1 matters, so the unit
+	// direction of the line segment stands in for P0P1
 	CSD1130::Vec2 BsP0 = lineSeg.m_pt0 - circle.m_center;
 	CSD1130::Vec2 BsP1 = lineSeg.m_pt1 - circle.m_center;
-	CSD1130::Vec2 P0P1 = lineSeg.m_pt1 - lineSeg.m_pt0;
-	float BsP0P0P1 = CSD1130::Vector2DDotProduct(BsP0, P0P1);
+	float BsP0P0P1 = CSD1130::Vector2DDotProduct(BsP0, lineSeg.m_dir);
 
-	// Calculate Velocity vector V and its outward normal M
+	// Calculate Velocity vector V and its outward normal M, both
+	// normalized with the one length of V
 	CSD1130::Vec2 V = ptEnd - circle.m_center;
-	CSD1130::Vec2 M(V.y, -V.x);
-	CSD1130::Vec2 Vnorm;
-	CSD1130::Vector2DNormalize(M, M);
-	CSD1130::Vector2DNormalize(Vnorm, V);
+	float lengthV = CSD1130::Vector2DLength(V);
+	CSD1130::Vec2 Vnorm = V / lengthV;
+	CSD1130::Vec2 M(Vnorm.y, -Vnorm.x);
 
 	// used for calculation later
 	float m, s, dist0, dist1;
@@ -223,13 +296,13 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 				// Reaching here means the circle movement is facing P0
 				// M is normalized outward normal of V
 				dist0 = CSD1130::Vector2DDotProduct(BsP0, M);				// Same as P0.M - Bs.M (shortest distance from P0 to V)
-				if (abs(dist0) > circle.m_radius)
+				if (std::abs(dist0) > circle.m_radius)
 					return 0;
 
 				// Reaching here means the circle movement is going towards P0
 				// The next line assumes the circle at collision time with P0
 				s = sqrt(circle.m_radius * circle.m_radius - dist0 * dist0);
-				interTime = (m - s) / CSD1130::Vector2DLength(V);
+				interTime = (m - s) / lengthV;
 				if (interTime <= 1) {
 					interPt = circle.m_center + V * interTime;
 
@@ -246,13 +319,13 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 				// Reaching here means the circle movement is facing P1
 				// M is normalized outward normal of V
 				dist1 = CSD1130::Vector2DDotProduct(BsP1, M);				// Same as P1.M - Bs.M
-				if (abs(dist1) > circle.m_radius)
+				if (std::abs(dist1) > circle.m_radius)
 					return 0;
 
 				// Reaching here means the cirlce movement is going towards P1
 				// The next line assumes the circle at collision time with P1
 				s = sqrt(circle.m_radius * circle.m_radius - dist1 * dist1);
-				interTime = (m - s) / CSD1130::Vector2DLength(V);
+				interTime = (m - s) / lengthV;
 				if (interTime <= 1) {
 					interPt = circle.m_center + V * interTime;
 
@@ -271,8 +344,8 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 		dist0 = CSD1130::Vector2DDotProduct(BsP0, M);						// Same as P0.M - Bs.M (M is normalized outward normal of V)
 		dist1 = CSD1130::Vector2DDotProduct(BsP1, M);						// Same as P1.M - Bs.M
 
-		float dist0_abs = abs(dist0);
-		float dist1_abs = abs(dist1);
+		float dist0_abs = std::abs(dist0);
+		float dist1_abs = std::abs(dist1);
 
 		if ((dist0_abs > circle.m_radius) && (dist1_abs > circle.m_radius))
 			return 0;
@@ -281,8 +354,8 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 			float m0 = CSD1130::Vector2DDotProduct(BsP0, V);
 			float m1 = CSD1130::Vector2DDotProduct(BsP1, V);
 
-			float m0_abs = abs(m0);
-			float m1_abs = abs(m1);
+			float m0_abs = std::abs(m0);
+			float m1_abs = std::abs(m1);
 
 			P0Side = (m0_abs < m1_abs);
 		}
@@ -298,7 +371,7 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 				// Reaching here means the circle movement is going towards P0
 				// The next line assumes the circle at collision time with P0
 				s = sqrt(circle.m_radius * circle.m_radius - dist0 * dist0);
-				interTime = (m - s) / CSD1130::Vector2DLength(V);
+				interTime = (m - s) / lengthV;
 				if (interTime <= 1) {
 					interPt = circle.m_center + V * interTime;
 
@@ -317,7 +390,7 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 				// Reaching here means the circle movement is going towards P1
 				// The next line assumes the circle at collision time with P1
 				s = sqrt(circle.m_radius * circle.m_radius - dist1 * dist1);
-				interTime = (m - s) / CSD1130::Vector2DLength(V);
+				interTime = (m - s) / lengthV;
 				if (interTime <= 1) {
 					interPt = circle.m_center + V * interTime;
 
@@ -335,6 +408,116 @@ int CheckMovingCircleToLineEdge(bool withinBothLines,
 
 } // end CheckMovingCircleToLineEdge
 
+/******************************************************************************/
+/*!
+* \brief Checks whether two circles overlap (touching counts).
+*
+* \param [in]	circle0				Const reference to the first Circle.
+
+  \param [in]	circle1				Const reference to the second Circle.
+
+  \param [out]	normal				Reference to a CSD1130::Vec2 for storing the
+									unit vector from the center of circle0 to
+									the center of circle1, (1, 0) if they are
+									the same. Will not be used if there is no
+									collision.
+
+  \return		bool				returns true if there is collision.
+ */
+/******************************************************************************/
+bool CollisionIntersection_CircleCircle(const Circle &circle0,
+	const Circle &circle1,
+	CSD1130::Vec2 &normal)
+{
+	CSD1130::Vec2 C0C1 = circle1.m_center - circle0.m_center;
+	float radiusSum = circle0.m_radius + circle1.m_radius;
+	float squareDist = CSD1130::Vector2DSquareLength(C0C1);
+
+	if (squareDist > radiusSum * radiusSum)
+		return false;
+
+	if (squareDist == 0.0f)
+		normal = CSD1130::Vec2(1.0f, 0.0f);
+	else
+		normal = C0C1 / sqrtf(squareDist);
+	return true;
+
+} // end CollisionIntersection_CircleCircle
+
+/******************************************************************************/
+/*!
+* \brief Calculate the collision between a moving circle and a circle that
+		 does not move, as the path of the moving center against the static
+		 circle grown by the moving radius.
+* 
+* \param [in]	circle				Const reference to Circle containing
+									start pos of the circle and its radius.
+
+  \param [in]	ptEnd				Const reference to CSD1130::Vec2 containing
+									end pos of the circle.
+
+  \param [in]	staticCircle		Const reference to the Circle that does
+									not move.
+
+  \param [out]	interPt				Reference to a CSD1130::Vec2 for storing the point
+									of intersection. Will not be used if there is
+									no collision.
+
+  \param [out]	normalAtCollision	Reference to a CSD1130::Vec2 for storing the
+									outward normal of staticCircle at point of
+									intersection.
+
+  \param [out]	interTime			Stores the time it takes until point of
+									intersection.
+
+  \return		int					returns 1 if there is collision, else 0.
+ */
+/******************************************************************************/
+int CollisionIntersection_MovingCircleCircle(const Circle &circle,
+	const CSD1130::Vec2 &ptEnd,
+	const Circle &staticCircle,
+	CSD1130::Vec2 &interPt,
+	CSD1130::Vec2 &normalAtCollision,
+	float &interTime)
+{
+	// Calculate Velocity vector V, and BsC from the start to the static center
+	CSD1130::Vec2 V = ptEnd - circle.m_center;
+	CSD1130::Vec2 BsC = staticCircle.m_center - circle.m_center;
+	float radiusSum = circle.m_radius + staticCircle.m_radius;
+
+	float VV	= CSD1130::Vector2DSquareLength(V),
+		  BsCV	= CSD1130::Vector2DDotProduct(BsC, V),
+		  dist	= CSD1130::Vector2DSquareLength(BsC) - radiusSum * radiusSum;
+
+	// Not moving, or moving away from the static circle
+	if (VV == 0.0f || BsCV <= 0.0f)
+		return 0;
+
+	// Bs already overlaps: collide at once so that the circle is sent out
+	if (dist <= 0.0f)
+		interTime = 0.0f;
+	else {
+		// Bs + V * t on the grown circle: VV * t^2 - 2 * BsCV * t + dist = 0
+		float discriminant = BsCV * BsCV - VV * dist;
+		if (discriminant < 0.0f)
+			return 0;
+
+		interTime = (BsCV - sqrtf(discriminant)) / VV;
+		if (interTime > 1.0f)
+			return 0;
+	}
+
+	interPt = circle.m_center + V * interTime;
+
+	// Normal of reflection is CBi normalized
+	CSD1130::Vec2 CBi = interPt - staticCircle.m_center;
+	if (CSD1130::Vector2DSquareLength(CBi) == 0.0f)
+		CBi = -V;
+	CSD1130::Vector2DNormalize(normalAtCollision, CBi);
+	return 1;
+
+} // end CollisionIntersection_MovingCircleCircle
+
 
 
 
@@ -375,3 +558,39 @@ void CollisionResponse_CircleLineSegment(const CSD1130::Vec2 &ptInter,
 	CSD1130::Vector2DNormalize(reflected, reflected);
 
 } // end CollisionResponse_CircleLineSegment
+
+
+
+/******************************************************************************/
+/*!
+* \brief Calculate the collision response between two touching circles:
+		 each circle moving towards the other reflects its velocity about
+		 the normal, so both keep their speed.
+
+  \param [in]		normal				Const reference to a CSD1130::Vec2
+										containing the unit vector from the
+										center of circle 0 to circle 1.
+
+* \param [in, out]	vel0				Reference to the velocity of circle 0.
+
+  \param [in, out]	vel1				Reference to the velocity of circle 1.
+ */
+/******************************************************************************/
+void CollisionResponse_CircleCircle(const CSD1130::Vec2 &normal,
+	CSD1130::Vec2 &vel0,
+	CSD1130::Vec2 &vel1)
+{
+	float N0 = CSD1130::Vector2DDotProduct(vel0, normal);
+	float N1 = CSD1130::Vector2DDotProduct(vel1, normal);
+
+	// Circles already moving apart are left alone, so touching circles do
+	// not bounce again every frame
+	if (N1 - N0 >= 0.0f)
+		return;
+
+	if (N0 > 0.0f)
+		vel0 = vel0 - 2 * N0 * normal;
+	if (N1 < 0.0f)
+		vel1 = vel1 - 2 * N1 * normal;
+
+} // end CollisionResponse_CircleCircle
@@ -0,0 +1,512 @@
+/******************************************************************************/
+/*!
+\file		CollisionBatch.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for
+			CollisionIntersectionBatch_CirclesLineSegment and
+			CollisionIntersectionBatch_CircleLineSegments,
+			Vector2DNormalizeBatchExact and Vector2DNormalizeBatchFast.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CollisionBatch.h"
+
+#if defined(__AVX__)
+	#define CSD1130_BATCH_AVX
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define CSD1130_BATCH_SSE2
+	#include <emmintrin.h>
+#endif
+
+#if defined(CSD1130_BATCH_AVX) || defined(CSD1130_BATCH_SSE2)
+
+namespace
+{
+	/**************************************************************************/
+	/*!
+		A register of float lanes. Comparisons return all-ones/all-zeros
+		lane masks, like the SSE/AVX compare instructions. Every comparison
+		is ordered, so a NaN lane compares false as in the scalar code.
+	 */
+	/**************************************************************************/
+#if defined(CSD1130_BATCH_AVX)
+	const unsigned int LANE_NUM = 8;
+
+	struct VFloat
+	{
+		__m256 v;
+	};
+
+	inline VFloat Load(const float *p)			{ return { _mm256_loadu_ps(p) }; }
+	inline void   Store(float *p, VFloat a)		{ _mm256_storeu_ps(p, a.v); }
+	inline VFloat Set1(float f)					{ return { _mm256_set1_ps(f) }; }
+	inline VFloat Zero()						{ return { _mm256_setzero_ps() }; }
+
+	inline VFloat operator + (VFloat a, VFloat b)	{ return { _mm256_add_ps(a.v, b.v) }; }
+	inline VFloat operator - (VFloat a, VFloat b)	{ return { _mm256_sub_ps(a.v, b.v) }; }
+	inline VFloat operator * (VFloat a, VFloat b)	{ return { _mm256_mul_ps(a.v, b.v) }; }
+	inline VFloat operator / (VFloat a, VFloat b)	{ return { _mm256_div_ps(a.v, b.v) }; }
+	inline VFloat operator & (VFloat a, VFloat b)	{ return { _mm256_and_ps(a.v, b.v) }; }
+	inline VFloat operator | (VFloat a, VFloat b)	{ return { _mm256_or_ps(a.v, b.v) }; }
+	inline VFloat operator ^ (VFloat a, VFloat b)	{ return { _mm256_xor_ps(a.v, b.v) }; }
+	inline VFloat AndNot(VFloat a, VFloat b)		{ return { _mm256_andnot_ps(a.v, b.v) }; }	// ~a & b
+	inline VFloat Sqrt(VFloat a)					{ return { _mm256_sqrt_ps(a.v) }; }
+	inline VFloat RSqrtEstimate(VFloat a)			{ return { _mm256_rsqrt_ps(a.v) }; }
+
+	inline VFloat operator <  (VFloat a, VFloat b)	{ return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+	inline VFloat operator <= (VFloat a, VFloat b)	{ return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+	inline VFloat operator >  (VFloat a, VFloat b)	{ return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+	inline VFloat operator >= (VFloat a, VFloat b)	{ return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+
+	inline int    MoveMask(VFloat a)				{ return _mm256_movemask_ps(a.v); }
+#else
+	const unsigned int LANE_NUM = 4;
+
+	struct VFloat
+	{
+		__m128 v;
+	};
+
+	inline VFloat Load(const float *p)			{ return { _mm_loadu_ps(p) }; }
+	inline void   Store(float *p, VFloat a)		{ _mm_storeu_ps(p, a.v); }
+	inline VFloat Set1(float f)					{ return { _mm_set1_ps(f) }; }
+	inline VFloat Zero()						{ return { _mm_setzero_ps() }; }
+
+	inline VFloat operator + (VFloat a, VFloat b)	{ return { _mm_add_ps(a.v, b.v) }; }
+	inline VFloat operator - (VFloat a, VFloat b)	{ return { _mm_sub_ps(a.v, b.v) }; }
+	inline VFloat operator * (VFloat a, VFloat b)	{ return { _mm_mul_ps(a.v, b.v) }; }
+	inline VFloat operator / (VFloat a, VFloat b)	{ return { _mm_div_ps(a.v, b.v) }; }
+	inline VFloat operator & (VFloat a, VFloat b)	{ return { _mm_and_ps(a.v, b.v) }; }
+	inline VFloat operator | (VFloat a, VFloat b)	{ return { _mm_or_ps(a.v, b.v) }; }
+	inline VFloat operator ^ (VFloat a, VFloat b)	{ return { _mm_xor_ps(a.v, b.v) }; }
+	inline VFloat AndNot(VFloat a, VFloat b)		{ return { _mm_andnot_ps(a.v, b.v) }; }		// ~a & b
+	inline VFloat Sqrt(VFloat a)					{ return { _mm_sqrt_ps(a.v) }; }
+	inline VFloat RSqrtEstimate(VFloat a)			{ return { _mm_rsqrt_ps(a.v) }; }
+
+	inline VFloat operator <  (VFloat a, VFloat b)	{ return { _mm_cmplt_ps(a.v, b.v) }; }
+	inline VFloat operator <= (VFloat a, VFloat b)	{ return { _mm_cmple_ps(a.v, b.v) }; }
+	inline VFloat operator >  (VFloat a, VFloat b)	{ return { _mm_cmpgt_ps(a.v, b.v) }; }
+	inline VFloat operator >= (VFloat a, VFloat b)	{ return { _mm_cmpge_ps(a.v, b.v) }; }
+
+	inline int    MoveMask(VFloat a)				{ return _mm_movemask_ps(a.v); }
+#endif
+
+	// lane-wise "mask ? a : b"
+	inline VFloat Select(VFloat mask, VFloat a, VFloat b)	{ return (mask & a) | AndNot(mask, b); }
+	inline VFloat AllOnes()									{ return Zero() <= Zero(); }
+	inline VFloat Not(VFloat mask)							{ return AndNot(mask, AllOnes()); }
+
+	inline VFloat SignBit()		{ return Set1(-0.0f); }
+	inline VFloat Neg(VFloat a)	{ return a ^ SignBit(); }
+	inline VFloat Abs(VFloat a)	{ return AndNot(SignBit(), a); }
+
+	// lane-wise CSD1130::Vector2DInvSqrtFast, the same estimate and Newton step
+	inline VFloat InvSqrtFast(VFloat x)
+	{
+		VFloat y		= RSqrtEstimate(x);
+		VFloat halfX	= Set1(0.5f) * x;
+		return y * (Set1(1.5f) - halfX * y * y);
+	}
+
+	/**************************************************************************/
+	/*!
+		Lane-wise CollisionIntersection_CircleLineSegment. Inputs are the
+		circle start C, end E and radius R, and the segment P0, P1 with
+		normal N, unit direction D, length L and N.P0. Outputs are zero on
+		lanes without collision.
+	 */
+	/**************************************************************************/
+	inline VFloat IntersectLanes(
+		VFloat Cx, VFloat Cy, VFloat Ex, VFloat Ey, VFloat R,
+		VFloat P0x, VFloat P0y, VFloat P1x, VFloat P1y, VFloat Nx, VFloat Ny,
+		VFloat Dx, VFloat Dy, VFloat L, VFloat NP0,
+		bool checkLineEdges,
+		VFloat &interTime, VFloat &interPtX, VFloat &interPtY, VFloat &normalX, VFloat &normalY)
+	{
+		const VFloat zero	= Zero();
+		const VFloat one	= Set1(1.0f);
+
+		// Velocity V and its outward normal M
+		VFloat Vx = Ex - Cx;
+		VFloat Vy = Ey - Cy;
+		VFloat Mx = Vy;
+		VFloat My = Neg(Vx);
+
+		// N.Bs & N.V
+		VFloat NBs	= Nx * Cx + Ny * Cy;
+		VFloat NV	= Nx * Vx + Ny * Vy;
+
+		VFloat dist		= NBs - NP0;
+		VFloat inLNS1	= dist <= Neg(R);							// inside half plane, away by at least R
+		VFloat inLNS2	= AndNot(inLNS1, dist >= R);				// outside half plane, away by at least R
+		VFloat outside	= inLNS1 | inLNS2;
+
+		// ---------------------------------------------------------------------
+		// LNS1 / LNS2: M.BsP0' = M.BsP0 -/+ R.(V.D), M.BsP1' = M.BsP0' - L.(N.V)
+		VFloat EBsP0x	= P0x - Cx;
+		VFloat EBsP0y	= P0y - Cy;
+
+		VFloat MBsP0	= Mx * EBsP0x + My * EBsP0y;
+		VFloat RVD		= R * (Vx * Dx + Vy * Dy);
+		VFloat LNV		= L * NV;
+
+		VFloat MBsP0prime	= Select(inLNS1, MBsP0 - RVD, MBsP0 + RVD);
+		VFloat MBsP1prime	= MBsP0prime - LNV;
+		VFloat crossing		= (MBsP0prime * MBsP1prime) < zero;
+
+		VFloat NP0NBs	= NP0 - NBs;
+		VFloat lineTime	= Select(inLNS1, NP0NBs - R, NP0NBs + R) / NV;
+		VFloat lineHit	= outside & crossing & (zero <= lineTime) & (lineTime <= one);
+
+		interTime	= lineTime;
+		interPtX	= Cx + Vx * lineTime;
+		interPtY	= Cy + Vy * lineTime;
+		normalX		= Select(inLNS1, Neg(Nx), Nx);
+		normalY		= Select(inLNS1, Neg(Ny), Ny);
+
+		// ---------------------------------------------------------------------
+		// Line edges, CheckMovingCircleToLineEdge
+		VFloat hit = lineHit;
+
+		// lanes starting between LNS1 and LNS2, or outside but not crossing
+		VFloat toEdge = zero;
+		if (checkLineEdges)
+			toEdge = Not(outside) | AndNot(crossing, outside);
+
+		if (MoveMask(toEdge)) {
+			VFloat withinBothLines = AndNot(outside, toEdge);
+
+			VFloat EBsP1x	= P1x - Cx;
+			VFloat EBsP1y	= P1y - Cy;
+			VFloat BsP0P0P1	= EBsP0x * Dx + EBsP0y * Dy;
+
+			// Normalized V and M
+			VFloat lenV		= Sqrt(Vx * Vx + Vy * Vy);
+			VFloat VnX		= Vx / lenV;
+			VFloat VnY		= Vy / lenV;
+			VFloat MnX		= VnY;
+			VFloat MnY		= Neg(VnX);
+
+			VFloat dist0	= EBsP0x * MnX + EBsP0y * MnY;
+			VFloat dist1	= EBsP1x * MnX + EBsP1y * MnY;
+			VFloat m0n		= EBsP0x * VnX + EBsP0y * VnY;
+			VFloat m1n		= EBsP1x * VnX + EBsP1y * VnY;
+			VFloat abs0		= Abs(dist0);
+			VFloat abs1		= Abs(dist1);
+
+			// Starting between both lines: the side is given by Bs.P0P1
+			VFloat sideW	= BsP0P0P1 > zero;
+			VFloat mW		= Select(sideW, m0n, m1n);
+			VFloat okW		= (mW > zero) & Not(Select(sideW, abs0, abs1) > R);
+
+			// Starting outside: the side is the edge closer to V
+			VFloat bothOut	= (abs0 > R) & (abs1 > R);
+			VFloat bothIn	= (abs0 <= R) & (abs1 <= R);
+			VFloat m0		= EBsP0x * Vx + EBsP0y * Vy;
+			VFloat m1		= EBsP1x * Vx + EBsP1y * Vy;
+			VFloat sideO	= Select(bothIn, Abs(m0) < Abs(m1), abs0 <= R);
+			VFloat mO		= Select(sideO, m0n, m1n);
+			VFloat okO		= Not(bothOut | (mO < zero));
+
+			VFloat P0Side	= Select(withinBothLines, sideW, sideO);
+			VFloat m		= Select(withinBothLines, mW, mO);
+			VFloat ok		= Select(withinBothLines, okW, okO);
+
+			// Circle at collision time with the edge
+			VFloat edgeDist	= Select(P0Side, dist0, dist1);
+			VFloat s		= Sqrt(R * R - edgeDist * edgeDist);
+			VFloat edgeTime	= (m - s) / lenV;
+			VFloat edgeHit	= toEdge & ok & (edgeTime <= one);
+
+			if (MoveMask(edgeHit)) {
+				VFloat Bix	= Cx + Vx * edgeTime;
+				VFloat Biy	= Cy + Vy * edgeTime;
+
+				// Normal of reflection is PBi normalized
+				VFloat PBix	= Bix - Select(P0Side, P0x, P1x);
+				VFloat PBiy	= Biy - Select(P0Side, P0y, P1y);
+#if CSD1130_FAST_NORMALIZE
+				VFloat invPBi	= InvSqrtFast(PBix * PBix + PBiy * PBiy);
+				VFloat PBinX	= PBix * invPBi;
+				VFloat PBinY	= PBiy * invPBi;
+#else
+				VFloat lenPBi	= Sqrt(PBix * PBix + PBiy * PBiy);
+				VFloat PBinX	= PBix / lenPBi;
+				VFloat PBinY	= PBiy / lenPBi;
+#endif
+
+				interTime	= Select(edgeHit, edgeTime, interTime);
+				interPtX	= Select(edgeHit, Bix, interPtX);
+				interPtY	= Select(edgeHit, Biy, interPtY);
+				normalX		= Select(edgeHit, PBinX, normalX);
+				normalY		= Select(edgeHit, PBinY, normalY);
+				hit			= hit | edgeHit;
+			}
+		}
+
+		interTime	= hit & interTime;
+		interPtX	= hit & interPtX;
+		interPtY	= hit & interPtY;
+		normalX		= hit & normalX;
+		normalY		= hit & normalY;
+		return hit;
+	}
+}
+
+#endif
+
+/******************************************************************************/
+/*!
+* \brief Tests N moving circles against one line segment.
+*
+* \param [in]	circles			Const reference to the circles as structure
+								of arrays: start pos, end pos and radius.
+
+  \param [in]	circleNum		Number of circles in circles.
+
+  \param [in]	lineSeg			Const reference to LineSegment containing the line.
+
+  \param [out]	result			One entry per circle, as returned by
+								CollisionIntersection_CircleLineSegment.
+
+  \param [in]	checkLineEdges	Flag to determine whether to check for
+								collision at line edges.
+
+  \return		unsigned int	Number of circles colliding with lineSeg.
+ */
+/******************************************************************************/
+unsigned int CollisionIntersectionBatch_CirclesLineSegment(const CircleBatch &circles,
+	unsigned int circleNum,
+	const LineSegment &lineSeg,
+	CollisionBatchResult &result,
+	bool checkLineEdges)
+{
+	unsigned int hitNum = 0;
+	unsigned int i = 0;
+
+#if defined(CSD1130_BATCH_AVX) || defined(CSD1130_BATCH_SSE2)
+	VFloat P0x = Set1(lineSeg.m_pt0.x), P0y = Set1(lineSeg.m_pt0.y);
+	VFloat P1x = Set1(lineSeg.m_pt1.x), P1y = Set1(lineSeg.m_pt1.y);
+	VFloat Nx = Set1(lineSeg.m_normal.x), Ny = Set1(lineSeg.m_normal.y);
+	VFloat Dx = Set1(lineSeg.m_dir.x), Dy = Set1(lineSeg.m_dir.y);
+	VFloat L = Set1(lineSeg.m_length), NP0 = Set1(lineSeg.m_NP0);
+
+	for (; i + LANE_NUM <= circleNum; i += LANE_NUM) {
+		VFloat interTime, interPtX, interPtY, normalX, normalY;
+		VFloat hit = IntersectLanes(
+			Load(circles.pStartX + i), Load(circles.pStartY + i),
+			Load(circles.pEndX + i), Load(circles.pEndY + i), Load(circles.pRadius + i),
+			P0x, P0y, P1x, P1y, Nx, Ny, Dx, Dy, L, NP0, checkLineEdges,
+			interTime, interPtX, interPtY, normalX, normalY);
+
+		Store(result.pInterTime + i, interTime);
+		Store(result.pInterPtX + i, interPtX);
+		Store(result.pInterPtY + i, interPtY);
+		Store(result.pNormalX + i, normalX);
+		Store(result.pNormalY + i, normalY);
+
+		int mask = MoveMask(hit);
+		for (unsigned int lane = 0; lane < LANE_NUM; ++lane)
+			result.pHit[i + lane] = (mask >> lane) & 1;
+		for (; mask; mask &= mask - 1)
+			++hitNum;
+	}
+#endif
+
+	// Remainder (or every pair without SIMD support) through the scalar test
+	for (; i < circleNum; ++i) {
+		Circle circle;
+		circle.m_center = CSD1130::Vec2(circles.pStartX[i], circles.pStartY[i]);
+		circle.m_radius = circles.pRadius[i];
+
+		CSD1130::Vec2 ptEnd(circles.pEndX[i], circles.pEndY[i]), interPt, normal;
+		float interTime = 0.0f;
+
+		result.pHit[i] = CollisionIntersection_CircleLineSegment(circle, ptEnd, lineSeg, interPt, normal, interTime, checkLineEdges);
+		if (result.pHit[i] == 0) {
+			interTime = 0.0f;
+			interPt = normal = CSD1130::Vec2();
+		}
+		else
+			++hitNum;
+
+		result.pInterTime[i]	= interTime;
+		result.pInterPtX[i]		= interPt.x;
+		result.pInterPtY[i]		= interPt.y;
+		result.pNormalX[i]		= normal.x;
+		result.pNormalY[i]		= normal.y;
+	}
+
+	return hitNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Tests one moving circle against N line segments.
+*
+* \param [in]	circle			Const reference to Circle containing
+								start pos of the circle and its radius.
+
+  \param [in]	ptEnd			Const reference to CSD1130::Vec2 containing
+								end pos of the circle.
+
+  \param [in]	lineSegs		Const reference to the line segments as
+								structure of arrays.
+
+  \param [in]	lineSegNum		Number of line segments in lineSegs.
+
+  \param [out]	result			One entry per segment, as returned by
+								CollisionIntersection_CircleLineSegment.
+
+  \param [in]	checkLineEdges	Flag to determine whether to check for
+								collision at line edges.
+
+  \return		unsigned int	Number of segments colliding with the circle.
+ */
+/******************************************************************************/
+unsigned int CollisionIntersectionBatch_CircleLineSegments(const Circle &circle,
+	const CSD1130::Vec2 &ptEnd,
+	const SegmentBatch &lineSegs,
+	unsigned int lineSegNum,
+	CollisionBatchResult &result,
+	bool checkLineEdges)
+{
+	unsigned int hitNum = 0;
+	unsigned int i = 0;
+
+#if defined(CSD1130_BATCH_AVX) || defined(CSD1130_BATCH_SSE2)
+	VFloat Cx = Set1(circle.m_center.x), Cy = Set1(circle.m_center.y);
+	VFloat Ex = Set1(ptEnd.x), Ey = Set1(ptEnd.y);
+	VFloat R = Set1(circle.m_radius);
+
+	for (; i + LANE_NUM <= lineSegNum; i += LANE_NUM) {
+		VFloat interTime, interPtX, interPtY, normalX, normalY;
+		VFloat hit = IntersectLanes(Cx, Cy, Ex, Ey, R,
+			Load(lineSegs.pPt0X + i), Load(lineSegs.pPt0Y + i),
+			Load(lineSegs.pPt1X + i), Load(lineSegs.pPt1Y + i),
+			Load(lineSegs.pNormalX + i), Load(lineSegs.pNormalY + i),
+			Load(lineSegs.pDirX + i), Load(lineSegs.pDirY + i),
+			Load(lineSegs.pLength + i), Load(lineSegs.pNP0 + i), checkLineEdges,
+			interTime, interPtX, interPtY, normalX, normalY);
+
+		Store(result.pInterTime + i, interTime);
+		Store(result.pInterPtX + i, interPtX);
+		Store(result.pInterPtY + i, interPtY);
+		Store(result.pNormalX + i, normalX);
+		Store(result.pNormalY + i, normalY);
+
+		int mask = MoveMask(hit);
+		for (unsigned int lane = 0; lane < LANE_NUM; ++lane)
+			result.pHit[i + lane] = (mask >> lane) & 1;
+		for (; mask; mask &= mask - 1)
+			++hitNum;
+	}
+#endif
+
+	// Remainder (or every pair without SIMD support) through the scalar test
+	for (; i < lineSegNum; ++i) {
+		LineSegment lineSeg;
+		lineSeg.m_pt0		= CSD1130::Vec2(lineSegs.pPt0X[i], lineSegs.pPt0Y[i]);
+		lineSeg.m_pt1		= CSD1130::Vec2(lineSegs.pPt1X[i], lineSegs.pPt1Y[i]);
+		lineSeg.m_normal	= CSD1130::Vec2(lineSegs.pNormalX[i], lineSegs.pNormalY[i]);
+		lineSeg.m_dir		= CSD1130::Vec2(lineSegs.pDirX[i], lineSegs.pDirY[i]);
+		lineSeg.m_length	= lineSegs.pLength[i];
+		lineSeg.m_NP0		= lineSegs.pNP0[i];
+
+		CSD1130::Vec2 interPt, normal;
+		float interTime = 0.0f;
+
+		result.pHit[i] = CollisionIntersection_CircleLineSegment(circle, ptEnd, lineSeg, interPt, normal, interTime, checkLineEdges);
+		if (result.pHit[i] == 0) {
+			interTime = 0.0f;
+			interPt = normal = CSD1130::Vec2();
+		}
+		else
+			++hitNum;
+
+		result.pInterTime[i]	= interTime;
+		result.pInterPtX[i]		= interPt.x;
+		result.pInterPtY[i]		= interPt.y;
+		result.pNormalX[i]		= normal.x;
+		result.pNormalY[i]		= normal.y;
+	}
+
+	return hitNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Normalizes N vectors in place with CSD1130::Vector2DNormalizeExact,
+		 bit-identical to it.
+*
+* \param [in,out]	pX				Pointer to the x of the vectors.
+*
+* \param [in,out]	pY				Pointer to the y of the vectors.
+*
+* \param [in]		count			Number of vectors.
+ */
+/******************************************************************************/
+void Vector2DNormalizeBatchExact(float *pX,
+	float *pY,
+	unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(CSD1130_BATCH_AVX) || defined(CSD1130_BATCH_SSE2)
+	for (; i + LANE_NUM <= count; i += LANE_NUM) {
+		VFloat x = Load(pX + i), y = Load(pY + i);
+		VFloat length = Sqrt(x * x + y * y);
+		Store(pX + i, x / length);
+		Store(pY + i, y / length);
+	}
+#endif
+
+	for (; i < count; ++i) {
+		CSD1130::Vec2 vec(pX[i], pY[i]);
+		CSD1130::Vector2DNormalizeExact(vec, vec);
+		pX[i] = vec.x;
+		pY[i] = vec.y;
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Normalizes N vectors in place with CSD1130::Vector2DNormalizeFast,
+		 bit-identical to it on the same CPU.
+*
+* \param [in,out]	pX				Pointer to the x of the vectors.
+*
+* \param [in,out]	pY				Pointer to the y of the vectors.
+*
+* \param [in]		count			Number of vectors.
+ */
+/******************************************************************************/
+void Vector2DNormalizeBatchFast(float *pX,
+	float *pY,
+	unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(CSD1130_BATCH_AVX) || defined(CSD1130_BATCH_SSE2)
+	for (; i + LANE_NUM <= count; i += LANE_NUM) {
+		VFloat x = Load(pX + i), y = Load(pY + i);
+		VFloat invLength = InvSqrtFast(x * x + y * y);
+		Store(pX + i, x * invLength);
+		Store(pY + i, y * invLength);
+	}
+#endif
+
+	for (; i < count; ++i) {
+		CSD1130::Vec2 vec(pX[i], pY[i]);
+		CSD1130::Vector2DNormalizeFast(vec, vec);
+		pX[i] = vec.x;
+		pY[i] = vec.y;
+	}
+}
@@ -21,14 +21,15 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 */
 /******************************************************************************/
 const unsigned int	GAME_OBJ_NUM_MAX		= 32;	//The total number of different objects (Shapes)
-const unsigned int	GAME_OBJ_INST_NUM_MAX	= 2048;	//The total number of different game object instances
+const unsigned int	GAME_OBJ_INST_CHUNK_NUM	= 1024;	//The minimum number of game object instances allocated at a time
+const size_t		LEVEL_ARENA_BLOCK_SIZE	= 1 << 20;	//The minimum number of bytes the level arena takes from the system at a time
+const char *const	REPLAY_FILE_NAME		= "CageReplay.bin";	//Log written with REPLAY 1, read with REPLAY 2
 
 //Flags
 const unsigned int	FLAG_ACTIVE				= 0x00000001;
 const unsigned int	FLAG_VISIBLE			= 0x00000002;
 const unsigned int	FLAG_NON_COLLIDABLE		= 0x00000004;
-
-const float			PI_OVER_180				= PI/180.0f;
+const unsigned int	FLAG_TRANSFORM_DIRTY	= 0x00000008;	// scale, dirCurr or posCurr changed since transform was computed
 
 
 //values: 0,1,2,3
@@ -37,6 +38,60 @@ const float			PI_OVER_180				= PI/180.0f;
 
 int EXTRA_CREDITS = 1;
 
+//values: 0,1
+//0: uniform grid broadphase for ball-vs-wall collision
+//1: bounding volume hierarchy broadphase for ball-vs-wall collision
+
+int BROADPHASE = 1;
+
+//values: 0,1,2
+//0: walls checked in index order, at most one reflection per wall per frame
+//1: continuous collision: earliest impact first, several bounces per frame
+//2: event driven: balls are only checked against the walls when their next
+//   impact, computed after each bounce, is due (for sparse cages)
+
+int COLLISION_MODE = 1;
+
+//values: 0,1
+//0: balls go through each other
+//1: balls bounce off each other (not with COLLISION_MODE 2)
+
+int BALL_COLLISION = 1;
+
+//values: 0,1,2,...
+//0: one worker thread per hardware thread for the ball update
+//1: ball update on the main thread only
+//n: n worker threads, the main thread included
+
+int THREAD_NUM = 0;
+
+//values: 0,1
+//0: no profiling
+//1: time the phases of each frame, P saves the last frames to CageProfile.json
+
+int PROFILER = 1;
+
+//values: 1,2,3,...
+//simulation steps per second: the balls move in steps of 1 / SIM_TICK_RATE
+//whatever the frame rate, and are drawn between the last two steps
+
+int SIM_TICK_RATE = 60;
+
+//values: 1,2,3,...
+//most steps simulated in one frame, a slower frame drops the time left over
+//instead of falling further behind at every frame
+
+int SIM_STEP_MAX = 4;
+
+//values: 0,1,2
+//0: no replay
+//1: record the frame times and the R/F keys, saved to CageReplay.bin when
+//   the state is unloaded
+//2: replay CageReplay.bin with the level and the settings it was recorded
+//   with, in place of the frame time and the keyboard, then quit
+
+int REPLAY = 0;
+
 
 
 enum class TYPE_OBJECT
@@ -65,12 +120,12 @@ struct GameObjInst
 	GameObj*			pObject;	// pointer to the 'original'
 	unsigned int		flag;		// bit flag or-ed together
 	float				scale;
-	CSD1130::Vec2		posCurr;	// object current position
-	CSD1130::Vec2		velCurr;	// object current velocity
+	CSD1130::Vec2		posCurr;	// object current position (balls move in sSim instead)
 	float				dirCurr;	// object current direction
-	float				speed;
+	unsigned int		ballIdx;	// index of the ball's simulation data in sSim.m_balls
+	unsigned int		activeIdx;	// position of the instance in sGameObjInstActive
 
-	CSD1130::Mtx33		transform;	// object drawing matrix
+	CSD1130::Aff2D		transform;	// object drawing matrix
 
 	// pointer to custom data specific for each object type
 	void*				pUserData;
@@ -86,20 +141,43 @@ struct GameObjInst
 static GameObj			*sGameObjList;
 static unsigned int		sGameObjNum;
 
-// list of object instances
-static GameObjInst		*sGameObjInstList;
-static unsigned int		sGameObjInstNum;
+// objects and object instances live in the level arena: the objects are
+// kept until the state is unloaded, the instances are dropped all at once
+// by the reset of each restart. Instances are allocated in chunks that never
+// move, so an instance pointer stays valid while the storage grows
+static LevelArena					sArena;
+static unsigned int					sGameObjInstNum;
+
+// stack of unused instances (the lowest one on top after a chunk is added),
+// and the used instances in creation order so that loops only visit those
+static std::vector<GameObjInst*>	sGameObjInstFree;
+static std::vector<GameObjInst*>	sGameObjInstActive;
 
 // function to create/destroy a game object instance
 GameObjInst*		gameObjInstCreate (	TYPE_OBJECT type,
 										float scale, 
 										CSD1130::Vec2* pPos,
-										CSD1130::Vec2* pVel,
 										float dir);
 void				gameObjInstDestroy(	GameObjInst* pInst);
 
-static Circle		*sBallData = 0;
-static LineSegment	*sWallData = 0;
+// function to make sure num more instances can be created without allocating
+void				gameObjInstReserve(	unsigned int num);
+
+// function to recompute the drawing matrix of an instance flagged dirty
+void				gameObjInstTransformUpdate(	GameObjInst* pInst);
+
+// level being played, balls, walls and pillars simulated from it, and the instance
+// drawing each ball
+static LevelBinary					sLevel;
+static CageSimulation				sSim;
+static std::vector<GameObjInst*>	sBallInst;
+
+// worker threads sharing the ball update
+static JobSystem					sJobs;
+
+// log recorded or replayed, kept across restarts, and the time step
+static CageReplay					sReplay;
+static float						sStepDt;
 
 
 
@@ -110,13 +188,53 @@ static LineSegment	*sWallData = 0;
 /******************************************************************************/
 void GameStateCageLoad(void)
 {
+	//replaying: the settings are the recorded ones
+	if (REPLAY == 2)
+	{
+		if (CageReplayRead(sReplay, REPLAY_FILE_NAME))
+		{
+			const CageReplaySettings &settings = sReplay.m_settings;
+			EXTRA_CREDITS	= settings.m_checkLineEdges;
+			BROADPHASE		= settings.m_broadphase;
+			COLLISION_MODE	= settings.m_collision;
+			BALL_COLLISION	= settings.m_ballCollision;
+			SIM_STEP_MAX	= settings.m_stepMax;
+		}
+		else
+		{
+			printf("Failed to read %s, not replaying\n", REPLAY_FILE_NAME);
+			REPLAY = 0;
+		}
+	}
+
 	//validating
 	if (EXTRA_CREDITS > 1 || EXTRA_CREDITS < 0)
 		EXTRA_CREDITS = 0;
-
-	sGameObjList		= (GameObj *)calloc(GAME_OBJ_NUM_MAX, sizeof(GameObj));
-	sGameObjInstList	= (GameObjInst *)calloc(GAME_OBJ_INST_NUM_MAX, sizeof(GameObjInst));
+	if (BROADPHASE > 1 || BROADPHASE < 0)
+		BROADPHASE = 0;
+	if (COLLISION_MODE > 2 || COLLISION_MODE < 0)
+		COLLISION_MODE = 0;
+	if (BALL_COLLISION > 1 || BALL_COLLISION < 0)
+		BALL_COLLISION = 0;
+	if (THREAD_NUM < 0)
+		THREAD_NUM = 0;
+	if (PROFILER > 1 || PROFILER < 0)
+		PROFILER = 0;
+	if (SIM_TICK_RATE < 1)
+		SIM_TICK_RATE = 60;
+	if (SIM_STEP_MAX < 1)
+		SIM_STEP_MAX = 1;
+	if (REPLAY > 2 || REPLAY < 0)
+		REPLAY = 0;
+
+	sStepDt = REPLAY == 2 ? sReplay.m_settings.m_stepDt : 1.0f / (float)SIM_TICK_RATE;
+
+	LevelArenaInit(sArena, LEVEL_ARENA_BLOCK_SIZE);
+	sGameObjList		= LevelArenaAllocArray<GameObj>(sArena, GAME_OBJ_NUM_MAX);
+	AE_ASSERT_ALLOC(sGameObjList);
+	LevelArenaKeep(sArena);
 	sGameObjNum = 0;
+	sGameObjInstNum = 0;
 
 	GameObj* pObj;
 
@@ -164,10 +282,32 @@ void GameStateCageLoad(void)
 
 	//------------------------------------------
 
+	// Creating the pillar object
+	pObj		= sGameObjList + sGameObjNum++;
+	pObj->type	= TYPE_OBJECT::TYPE_OBJECT_PILLAR;
+
+	AEGfxMeshStart();
+
+	//Creating the pillar shape, a unit circle like the ball
+	for(float i = 0; i < Parts; ++i)
+	{
+		AEGfxTriAdd(
+		0.0f, 0.0f, 0xFF808080, 0.0f, 0.0f,
+		cosf(i*2*PI/Parts)*1.0f,  sinf(i*2*PI/Parts)*1.0f, 0xFFFFFFFF, 0.0f, 0.0f,
+		cosf((i+1)*2*PI/Parts)*1.0f,  sinf((i+1)*2*PI/Parts)*1.0f, 0xFFFFFFFF, 0.0f, 0.0f);
+	}
+
+	pObj->pMesh = AEGfxMeshEnd();
+
+	//------------------------------------------
+
 	
 
 	AEGfxSetBackgroundColor(0.2f, 0.2f, 0.2f);
 
+	JobSystemInit(sJobs, (unsigned int)THREAD_NUM);
+	ProfilerInit(PROFILER == 1);
+
 	
 }
 
@@ -179,88 +319,102 @@ void GameStateCageLoad(void)
 void GameStateCageInit(void)
 {
 	GameObjInst *pInst;
-	std::string str;
-	std::ifstream inFile;
+	const char *pLevelName = 0;
 
 	if(EXTRA_CREDITS == 0)
-		inFile.open("..\\Bin\\Resources\\LevelData - Original.txt");
+		pLevelName = "..\\Bin\\Resources\\LevelData - Original";
 	else if (EXTRA_CREDITS == 1)
-		inFile.open("..\\Bin\\Resources\\LevelData - Extra Credits.txt");
-	
-	
-	if(inFile.is_open())
+		pLevelName = "..\\Bin\\Resources\\LevelData - Extra Credits";
+
+	// map the level compiled by LevelCompiler when there is one, and it
+	// was compiled from the text file as it is now, else compile the text
+	// file in memory. A replay brings its own level. A restart finds the
+	// level still loaded by the previous run
+	bool levelRestarted = sLevel.m_pHeader != NULL;
+	bool levelLoaded = levelRestarted;
+	if(!levelLoaded && REPLAY == 2)
+		levelLoaded = CageReplayLevel(sReplay, sLevel);
+	else if(!levelLoaded && pLevelName)
 	{
-		// read ball data
-		float dir, speed, scale;
-		unsigned int ballNum = 0;
-		inFile>>ballNum;
-		sBallData = new Circle[ballNum];
+		std::string fileName = pLevelName;
+		levelLoaded = LevelBinaryOpen(sLevel, (fileName + ".bin").c_str());
 
-		for(unsigned int i = 0; i < ballNum; ++i)
+		unsigned long long sourceHash = 0;
+		if(levelLoaded && LevelDataHashFile((fileName + ".txt").c_str(), sourceHash) &&
+			sLevel.m_pHeader->m_sourceHash != sourceHash)
 		{
-			// read pos
-			inFile >> str >> sBallData[i].m_center.x;
-			inFile >> str >> sBallData[i].m_center.y;
-			// read direction
-			inFile >> str >> dir;
-			// read speed
-			inFile >> str >> speed;
-			// read radius
-			inFile >> str >> sBallData[i].m_radius;
-			
-			// create ball instance
-			CSD1130::Vec2 vel	= CSD1130::Vec2(cos(dir * PI_OVER_180) * speed, sin(dir * PI_OVER_180) * speed);
-			pInst				= gameObjInstCreate(TYPE_OBJECT::TYPE_OBJECT_BALL, sBallData[i].m_radius, 
-													&sBallData[i].m_center, &vel, 0.0f);
-			AE_ASSERT(pInst);
-			pInst->speed = speed;
-			pInst->pUserData = &sBallData[i];
+			printf("%s.bin is older than %s.txt, compiling the text file\n", pLevelName, pLevelName);
+			LevelBinaryClose(sLevel);
+			levelLoaded = false;
 		}
 
-		// read wall data
-		unsigned int wallNum = 0;
-		CSD1130::Vec2 P0 = CSD1130::Vec2(), P1 = CSD1130::Vec2();
-		CSD1130::Vec2 pos = CSD1130::Vec2(), e = CSD1130::Vec2();
+		if(!levelLoaded)
+		{
+			LevelData levelData;
+			levelLoaded = LevelDataLoad(levelData, (fileName + ".txt").c_str()) &&
+							LevelBinaryBuild(sLevel, levelData);
+		}
+	}
+	
+	
+	if(levelLoaded)
+	{
+		// the simulation moves the balls, the instances only draw them.
+		// On restart it keeps the broadphase of the walls and pillars
+		if(levelRestarted)
+			CageSimRestart(sSim, sLevel);
+		else
+			CageSimInit(sSim, sLevel, BROADPHASE, COLLISION_MODE, EXTRA_CREDITS == 1, BALL_COLLISION == 1);
+
+		// the log starts with the level and the settings of the first run,
+		// restarts are replayed from the frames
+		if(REPLAY == 1 && sReplay.m_level.empty())
+		{
+			CageReplaySettings settings;
+			settings.m_broadphase		= BROADPHASE;
+			settings.m_collision		= COLLISION_MODE;
+			settings.m_checkLineEdges	= EXTRA_CREDITS == 1 ? 1 : 0;
+			settings.m_ballCollision	= BALL_COLLISION;
+			settings.m_stepDt			= sStepDt;
+			settings.m_stepMax			= SIM_STEP_MAX;
+			CageReplayBegin(sReplay, settings, sLevel);
+		}
 
-		inFile>>wallNum;
-		sWallData = new LineSegment[wallNum];
+		// create ball instances
+		gameObjInstReserve(sLevel.m_ballNum);
+		sBallInst.reserve(sLevel.m_ballNum);
 
-		for(unsigned int i = 0; i < wallNum; ++i)
+		for(unsigned int i = 0; i < sLevel.m_ballNum; ++i)
 		{
-			inFile>>str>> P0.x;
-			inFile>>str>> P0.y;
-			inFile>>str>> P1.x;
-			inFile>>str>> P1.y;
-
-			//stupid work
-			pos.x = (P0.x + P1.x) * 0.5f;
-			pos.y = (P0.y + P1.y) * 0.5f;
-			e.x = P1.x - P0.x;
-			e.y = P1.y - P0.y;
-			scale = sqrtf((e.x * e.x) + (e.y * e.y));
-			//a.b = |a|*|b|*cos(a,b)
-			float cosine = (e.x/* * 1.0f + e.y * 0.0f*/) / (scale);//assuming scale is non-zero (controlling our data input!)
-			float acosine = acos(cosine);
-			if (e.y < 0.0f)
-				acosine = 2*PI - acosine;
+			CSD1130::Vec2 pos = sLevel.m_pBalls[i].m_center;
+			pInst = gameObjInstCreate(TYPE_OBJECT::TYPE_OBJECT_BALL, sLevel.m_pBalls[i].m_radius, &pos, 0.0f);
+			AE_ASSERT(pInst);
+		}
 
+		// create wall instances, drawn with the transform compiled with the level
+		gameObjInstReserve(sLevel.m_wallNum);
 
+		for(unsigned int i = 0; i < sLevel.m_wallNum; ++i)
+		{
+			const LevelWallDraw &wallDraw = sLevel.m_pWallDraw[i];
+			CSD1130::Vec2 pos = wallDraw.m_pos;
 
-			//NOTE to student: When using your own build line segment function, comment out this next line, and uncomment the line after
-			//AEBuildLineSegment(sWallData[i], pos, scale, acosine);
-			BuildLineSegment(sWallData[i], P0, P1);
+			pInst = gameObjInstCreate(TYPE_OBJECT::TYPE_OBJECT_WALL, wallDraw.m_scale, &pos, wallDraw.m_angle);
+			AE_ASSERT(pInst);
+			pInst->pUserData = (void *)&sSim.m_pWalls[i];
+		}
 
+		// create pillar instances, they never move either
+		gameObjInstReserve(sLevel.m_pillarNum);
 
+		for(unsigned int i = 0; i < sLevel.m_pillarNum; ++i)
+		{
+			CSD1130::Vec2 pos = sLevel.m_pPillars[i].m_center;
 
-			pInst = gameObjInstCreate(TYPE_OBJECT::TYPE_OBJECT_WALL, scale, &pos, 0, acosine);
+			pInst = gameObjInstCreate(TYPE_OBJECT::TYPE_OBJECT_PILLAR, sLevel.m_pPillars[i].m_radius, &pos, 0.0f);
 			AE_ASSERT(pInst);
-			pInst->pUserData = &sWallData[i];
+			pInst->pUserData = (void *)&sSim.m_pPillars[i];
 		}
-
-		
-
-		inFile.clear();
-		inFile.close();
 	}
 	else
 	{
@@ -278,110 +432,85 @@ void GameStateCageInit(void)
 /******************************************************************************/
 void GameStateCageUpdate(void)
 {
-	static bool full_screen_me;
+	ProfilerFrameBegin();
+
+	long long inputScope = ProfilerScopeBegin("Input");
+
+	// time and keys of this frame, from the log when replaying
+	float frameDt = g_dt;
+	unsigned char keys = 0;
+	if (AEInputCheckTriggered(AEVK_R))
+		keys |= CAGE_REPLAY_KEY_RESTART;
 	if (AEInputCheckTriggered(AEVK_F))
+		keys |= CAGE_REPLAY_KEY_FULLSCREEN;
+
+	if (REPLAY == 2)
+	{
+		if (!CageReplayNext(sReplay, frameDt, keys))
+		{
+			// every frame was replayed
+			frameDt = 0.0f;
+			keys = 0;
+			gGameStateNext = GS_STATE::GS_QUIT;
+		}
+	}
+	else if (REPLAY == 1)
+		CageReplayRecord(sReplay, frameDt, keys);
+
+	static bool full_screen_me;
+	if (keys & CAGE_REPLAY_KEY_FULLSCREEN)
 	{
 		full_screen_me = !full_screen_me;
 		AEToogleFullScreen(full_screen_me);
 	}
 
-	
-	CSD1130::Vec2		interPtA;
-	CSD1130::Vec2      normalAtCollision;
-	float		interTime = 0.0f;
+	if (AEInputCheckTriggered(AEVK_P))
+		ProfilerWriteChromeTrace("CageProfile.json");
 
-	//f32 fpsT = (f32)AEFrameRateControllerGetFrameTime();
+	ProfilerScopeEnd(inputScope);
 
-	//Update object instances positions
-	for(unsigned int i = 0; i < GAME_OBJ_INST_NUM_MAX; ++i)
-	{
-		GameObjInst *pBallInst = sGameObjInstList + i;
 
-		// skip non-active object
-		if (0 == (pBallInst->flag & FLAG_ACTIVE) ||
-			pBallInst->pObject->type != TYPE_OBJECT::TYPE_OBJECT_BALL)
-			continue;
+	//Update ball positions in fixed steps, as many as the frame time
+	//covers, the rest is simulated with the next frame
+	CageSimAdvance(sSim, frameDt, sStepDt, (unsigned int)SIM_STEP_MAX, &sJobs);
 
-		CSD1130::Vec2 posNext;
-		posNext.x = pBallInst->posCurr.x + pBallInst->velCurr.x * g_dt;
-		posNext.y = pBallInst->posCurr.y + pBallInst->velCurr.y * g_dt;
+	
+	//Computing the transformation matrices of the instances that moved,
+	//walls and pillars never move and keep the one computed when they were created
+	long long transformScope = ProfilerScopeBegin("Transform");
 
-		// Update the latest ball data with the lastest ball's position
-		Circle &ballData	= *((Circle*)pBallInst->pUserData);
-		ballData.m_center.x = pBallInst->posCurr.x;
-		ballData.m_center.y = pBallInst->posCurr.y;
+	const float *pPrevPosX	= sSim.m_balls.m_prevPosX.data();
+	const float *pPrevPosY	= sSim.m_balls.m_prevPosY.data();
+	const float *pPosX		= sSim.m_balls.m_posX.data();
+	const float *pPosY		= sSim.m_balls.m_posY.data();
+	const float *pRadius	= sSim.m_balls.m_radius.data();
 
-		// Check collision with walls
-		for(unsigned int j = 0; j < GAME_OBJ_INST_NUM_MAX; ++j)
-		{
-			GameObjInst *pInst = sGameObjInstList + j;
+	// fraction of the next step already elapsed
+	const float alpha = (float)(sSim.m_frameTimeLeft / sStepDt);
 
-			if (0 == (pInst->flag & FLAG_ACTIVE))
-				continue;
+	for(unsigned int i = 0; i < sBallInst.size(); ++i)
+	{
+		GameObjInst *pInst = sBallInst[i];
 
-			switch(pInst->pObject->type)
-			{
-				case TYPE_OBJECT::TYPE_OBJECT_WALL:
-				{
-					LineSegment &lineSegData = *((LineSegment*)pInst->pUserData);
-
-					bool checkLineEdges = false;
-					if (EXTRA_CREDITS == 1)
-						checkLineEdges = true;
-					
-					if ((pBallInst->velCurr.x * lineSegData.m_normal.x + pBallInst->velCurr.y * lineSegData.m_normal.y) < 0.0f)
-					{
-						if (CollisionIntersection_CircleLineSegment(ballData,
-							posNext,
-							lineSegData,
-							interPtA,
-							normalAtCollision,
-							interTime,
-							checkLineEdges))
-						{
-							CSD1130::Vec2 reflectedVec;
-
-							CollisionResponse_CircleLineSegment(interPtA,
-							normalAtCollision,
-							posNext,
-							reflectedVec);
-
-							pBallInst->velCurr.x = reflectedVec.x * pBallInst->speed;
-							pBallInst->velCurr.y = reflectedVec.y * pBallInst->speed;
-						}
-					}
-				}
-				break;
-				
-				
+		// balls are drawn between the last two steps, so that they move
+		// smoothly when there are more frames than steps
+		float posX = pPrevPosX[i] + (pPosX[i] - pPrevPosX[i]) * alpha;
+		float posY = pPrevPosY[i] + (pPosY[i] - pPrevPosY[i]) * alpha;
 
-			}
+		if (pInst->posCurr.x != posX || pInst->posCurr.y != posY || pInst->scale != pRadius[i])
+		{
+			pInst->posCurr.x	= posX;
+			pInst->posCurr.y	= posY;
+			pInst->scale		= pRadius[i];
+			pInst->flag			|= FLAG_TRANSFORM_DIRTY;
 		}
 
-		pBallInst->posCurr.x = posNext.x;
-		pBallInst->posCurr.y = posNext.y;
+		gameObjInstTransformUpdate(pInst);
 	}
 
-	
-	//Computing the transformation matrices of the game object instances
-	for(unsigned int i = 0; i < GAME_OBJ_INST_NUM_MAX; ++i)
-	{
-		CSD1130::Mtx33 scale, rot, trans;
-		GameObjInst *pInst = sGameObjInstList + i;
-
-		// skip non-active object
-		if (0 == (pInst->flag & FLAG_ACTIVE))
-			continue;
+	ProfilerScopeEnd(transformScope);
 
-		Mtx33Scale(scale, pInst->scale, pInst->scale);
-		Mtx33RotRad(rot, pInst->dirCurr);
-		Mtx33Translate(trans, pInst->posCurr.x, pInst->posCurr.y);
-
-		pInst->transform = scale * rot;
-		pInst->transform = trans * pInst->transform;
-	}
-
-	if(AEInputCheckTriggered(AEVK_R))
+	if(keys & CAGE_REPLAY_KEY_RESTART)
 		gGameStateNext = GS_STATE::GS_RESTART;
 }
 
@@ -392,6 +521,8 @@ void GameStateCageUpdate(void)
 /******************************************************************************/
 void GameStateCageDraw(void)
 {
+	PROFILE_SCOPE("Draw");
+
 	AEGfxSetBlendMode(AE_GFX_BM_BLEND);
 	
 	AEGfxSetRenderMode(AE_GFX_RM_COLOR);
@@ -401,15 +532,18 @@ void GameStateCageDraw(void)
 	
 	//Drawing the object instances
 	int only4 = 0;
-	for (unsigned int i = 0; i < GAME_OBJ_INST_NUM_MAX; i++)
+	for (unsigned int i = 0; i < sGameObjInstNum; i++)
 	{
-		GameObjInst* pInst = sGameObjInstList + i;
+		GameObjInst* pInst = sGameObjInstActive[i];
 
-		// skip non-active object
-		if (0 == (pInst->flag & FLAG_ACTIVE) || 0 == (pInst->flag & FLAG_VISIBLE))
+		// skip non-visible object
+		if (0 == (pInst->flag & FLAG_VISIBLE))
 			continue;
 		
-		AEGfxSetTransform(pInst->transform.m2);
+		// the engine takes a full 3x3 matrix
+		CSD1130::Mtx33 drawTransform;
+		Aff2DToMtx33(drawTransform, pInst->transform);
+		AEGfxSetTransform(drawTransform.m2);
 
 		if (pInst->pObject->type == TYPE_OBJECT::TYPE_OBJECT_BALL)
 		{
@@ -432,6 +566,11 @@ void GameStateCageDraw(void)
 			AEGfxSetTintColor(1.0f, 1.0f, 1.0f, 1.0f);
 			AEGfxMeshDraw(pInst->pObject->pMesh, AE_GFX_MDM_LINES_STRIP);
 		}
+		else if (pInst->pObject->type == TYPE_OBJECT::TYPE_OBJECT_PILLAR)
+		{
+			AEGfxSetTintColor(0.6f, 0.6f, 0.8f, 1.0f);
+			AEGfxMeshDraw(pInst->pObject->pMesh, AE_GFX_MDM_TRIANGLES);
+		}
 	}
 	
 	char strBuffer[100];
@@ -455,16 +594,21 @@ void GameStateCageDraw(void)
 /******************************************************************************/
 void GameStateCageFree(void)
 {
-	// kill all object in the list
-	for (unsigned int i = 0; i < GAME_OBJ_INST_NUM_MAX; i++)
-		gameObjInstDestroy(sGameObjInstList + i);
-
-	delete []sBallData;
-	sBallData = NULL;
-	
-	delete []sWallData;
-	sWallData = NULL;
-
+	// kill all object in the list at once, the next run allocates the
+	// instances again from the start of the arena, in the same order
+	sGameObjInstNum = 0;
+	sGameObjInstFree.clear();
+	sGameObjInstActive.clear();
+	sBallInst.clear();
+	LevelArenaReset(sArena);
+
+	// a restart plays the same level again, the simulation puts its balls
+	// back in place and keeps everything else
+	if (gGameStateNext != GS_STATE::GS_RESTART)
+	{
+		CageSimClear(sSim);
+		LevelBinaryClose(sLevel);
+	}
 }
 
 /******************************************************************************/
@@ -478,8 +622,18 @@ void GameStateCageUnload(void)
 	for (u32 i = 0; i < sGameObjNum; i++)
 		AEGfxMeshFree(sGameObjList[i].pMesh);
 
-	free(sGameObjInstList);
-	free(sGameObjList);
+	LevelArenaRelease(sArena);
+	sGameObjList = NULL;
+
+	sGameObjInstFree.clear();
+	sGameObjInstActive.clear();
+
+	JobSystemShutdown(sJobs);
+	ProfilerShutdown();
+
+	if (REPLAY == 1 && !CageReplayWrite(sReplay, REPLAY_FILE_NAME))
+		printf("Failed to write %s\n", REPLAY_FILE_NAME);
+	CageReplayClear(sReplay);
 }
 
 /******************************************************************************/
@@ -490,36 +644,45 @@ void GameStateCageUnload(void)
 GameObjInst* gameObjInstCreate(TYPE_OBJECT type,
 							   float scale, 
 	CSD1130::Vec2* pPos,
-	CSD1130::Vec2* pVel,
 							   float dir)
 {
 	CSD1130::Vec2 zero = CSD1130::Vec2();
 
 	AE_ASSERT_PARM(type < TYPE_OBJECT(sGameObjNum));
 	
-	// loop through the object instance list to find a non-used object instance
-	for (unsigned int i = 0; i < GAME_OBJ_INST_NUM_MAX; i++)
+	// grow by a chunk when every instance is used
+	if (sGameObjInstFree.empty())
+		gameObjInstReserve(1);
+	if (sGameObjInstFree.empty())
+		return 0;
+
+	// take the most recently freed instance
+	GameObjInst* pInst = sGameObjInstFree.back();
+	sGameObjInstFree.pop_back();
+
+	pInst->pObject			 = sGameObjList + (int)type;
+	pInst->flag				 = FLAG_ACTIVE | FLAG_VISIBLE | FLAG_TRANSFORM_DIRTY;
+	pInst->scale			 = scale;
+	pInst->posCurr			 = pPos ? *pPos : zero;
+	pInst->dirCurr			 = dir;
+	pInst->ballIdx			 = 0;
+	pInst->activeIdx		 = sGameObjInstNum++;
+	pInst->pUserData		 = 0;
+
+	sGameObjInstActive.push_back(pInst);
+
+	// balls are simulated in sSim, created in the same order by CageSimInit,
+	// the instance only draws them
+	if (type == TYPE_OBJECT::TYPE_OBJECT_BALL)
 	{
-		GameObjInst* pInst = sGameObjInstList + i;
-
-		// check if current instance is not used
-		if ((pInst->flag & FLAG_ACTIVE) == 0)
-		{
-			// it is not used => use it to create the new instance
-			pInst->pObject			 = sGameObjList + (int)type;
-			pInst->flag				 = FLAG_ACTIVE | FLAG_VISIBLE;
-			pInst->scale			 = scale;
-			pInst->posCurr			 = pPos ? *pPos : zero;
-			pInst->velCurr			 = pVel ? *pVel : zero;
-			pInst->dirCurr			 = dir;
-			pInst->pUserData		 = 0;
-			
-			// return the newly created instance
-			return pInst;
-		}
+		pInst->ballIdx = (unsigned int)sBallInst.size();
+		sBallInst.push_back(pInst);
 	}
 
-	return 0;
+	gameObjInstTransformUpdate(pInst);
+
+	// return the newly created instance
+	return pInst;
 }
 
 /******************************************************************************/
@@ -533,6 +696,64 @@ void gameObjInstDestroy(GameObjInst* pInst)
 	if (pInst->flag == 0)
 		return;
 
+	// keep the simulation dense, the last ball takes the freed slot
+	if (pInst->pObject->type == TYPE_OBJECT::TYPE_OBJECT_BALL)
+	{
+		unsigned int movedIdx = CageSimRemoveBall(sSim, pInst->ballIdx);
+		sBallInst[pInst->ballIdx] = sBallInst[movedIdx];
+		sBallInst[pInst->ballIdx]->ballIdx = pInst->ballIdx;
+		sBallInst.pop_back();
+	}
+
+	// keep the active list dense, the last active instance takes the slot
+	GameObjInst* pLast = sGameObjInstActive[--sGameObjInstNum];
+	sGameObjInstActive[pInst->activeIdx] = pLast;
+	pLast->activeIdx = pInst->activeIdx;
+	sGameObjInstActive.pop_back();
+
+	sGameObjInstFree.push_back(pInst);
+
 	// zero out the flag
 	pInst->flag = 0;
-}
\ No newline at end of file
+}
+
+/******************************************************************************/
+/*!
+	Make sure num more game object instances can be created without
+	allocating, by adding one chunk of at least GAME_OBJ_INST_CHUNK_NUM
+	instances if needed
+*/
+/******************************************************************************/
+void gameObjInstReserve(unsigned int num)
+{
+	if (sGameObjInstFree.size() >= num)
+		return;
+
+	unsigned int chunkNum = num - (unsigned int)sGameObjInstFree.size();
+	if (chunkNum < GAME_OBJ_INST_CHUNK_NUM)
+		chunkNum = GAME_OBJ_INST_CHUNK_NUM;
+
+	GameObjInst* pChunk = LevelArenaAllocArray<GameObjInst>(sArena, chunkNum);
+	AE_ASSERT_ALLOC(pChunk);
+
+	// push the new instances so that the first one is handed out first
+	sGameObjInstFree.reserve(sGameObjInstFree.size() + chunkNum);
+	for (unsigned int i = chunkNum; i > 0; --i)
+		sGameObjInstFree.push_back(pChunk + i - 1);
+	sGameObjInstActive.reserve(sGameObjInstActive.size() + sGameObjInstFree.size());
+}
+
+/******************************************************************************/
+/*!
+	Recompute the drawing matrix of an instance whose scale, direction or
+	position changed, written out as translate * scale * rotate
+*/
+/******************************************************************************/
+void gameObjInstTransformUpdate(GameObjInst* pInst)
+{
+	if (0 == (pInst->flag & FLAG_TRANSFORM_DIRTY))
+		return;
+
+	Aff2DCompose(pInst->transform, pInst->posCurr.x, pInst->posCurr.y, pInst->scale, pInst->scale, pInst->dirCurr);
+	pInst->flag &= ~FLAG_TRANSFORM_DIRTY;
+}
@@ -0,0 +1,223 @@
+/******************************************************************************/
+/*!
+\file		JobSystem.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for JobSystemInit,
+			JobSystemParallelFor, JobSystemWorkerNum and JobSystemShutdown.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "JobSystem.h"
+
+namespace
+{
+	/**************************************************************************/
+	/*!
+		Takes a job for workerIdx: the newest one of its own queue, else
+		the oldest one of another worker's queue
+	 */
+	/**************************************************************************/
+	bool JobTake(JobSystem &jobs, unsigned int workerIdx, Job &job)
+	{
+		{
+			JobQueue &queue = jobs.m_queues[workerIdx];
+			std::lock_guard<std::mutex> lock(queue.m_mutex);
+			if (!queue.m_jobs.empty()) {
+				job = queue.m_jobs.back();
+				queue.m_jobs.pop_back();
+				jobs.m_queued.fetch_sub(1);
+				return true;
+			}
+		}
+
+		for (unsigned int i = 1; i < jobs.m_workerNum; ++i) {
+			JobQueue &queue = jobs.m_queues[(workerIdx + i) % jobs.m_workerNum];
+			std::lock_guard<std::mutex> lock(queue.m_mutex);
+			if (!queue.m_jobs.empty()) {
+				job = queue.m_jobs.front();
+				queue.m_jobs.pop_front();
+				jobs.m_queued.fetch_sub(1);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void JobRun(JobSystem &jobs, const Job &job, unsigned int workerIdx)
+	{
+		job.m_pFunc(job.m_pUserData, job.m_begin, job.m_end, workerIdx);
+
+		// release: the caller sees what the job wrote once m_pending is 0
+		jobs.m_pending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	// Runs jobs until the system shuts down, sleeping while there are none
+	void WorkerMain(JobSystem *pJobs, unsigned int workerIdx)
+	{
+		JobSystem &jobs = *pJobs;
+		Job job;
+
+		for (;;) {
+			if (JobTake(jobs, workerIdx, job)) {
+				JobRun(jobs, job, workerIdx);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(jobs.m_wakeMutex);
+			jobs.m_wake.wait(lock, [&jobs] { return jobs.m_quit || jobs.m_queued.load() > 0; });
+			if (jobs.m_quit)
+				return;
+		}
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Starts the worker threads.
+*
+* \param [out]	jobs			Reference to JobSystem to be set.
+*
+* \param [in]	workerNum		Number of workers including the calling
+								thread, 0 for one per hardware thread.
+ */
+/******************************************************************************/
+void JobSystemInit(JobSystem &jobs,
+	unsigned int workerNum)
+{
+	JobSystemShutdown(jobs);
+
+	if (workerNum == 0)
+		workerNum = std::thread::hardware_concurrency();
+	if (workerNum == 0)
+		workerNum = 1;
+
+	jobs.m_workerNum = workerNum;
+	jobs.m_queues.reset(new JobQueue[workerNum]);
+	jobs.m_queued	= 0;
+	jobs.m_pending	= 0;
+	jobs.m_quit		= false;
+
+	jobs.m_threads.reserve(workerNum - 1);
+	for (unsigned int i = 1; i < workerNum; ++i)
+		jobs.m_threads.emplace_back(WorkerMain, &jobs, i);
+}
+
+/******************************************************************************/
+/*!
+* \brief Runs pFunc over [begin, end) in chunks of chunkSize items on every
+		 worker, and returns once all of them are done. Chunks are dealt out
+		 in contiguous blocks, one block per worker.
+*
+* \param [in,out]	jobs		Reference to the JobSystem.
+*
+* \param [in]		begin		First item of the range.
+*
+* \param [in]		end			One past the last item of the range.
+*
+* \param [in]		chunkSize	Number of items per job.
+*
+* \param [in]		pFunc		Function running the items of a chunk.
+*
+* \param [in]		pUserData	Data passed to pFunc.
+ */
+/******************************************************************************/
+void JobSystemParallelFor(JobSystem &jobs,
+	unsigned int begin,
+	unsigned int end,
+	unsigned int chunkSize,
+	JobFunc pFunc,
+	void *pUserData)
+{
+	if (begin >= end)
+		return;
+	if (chunkSize == 0)
+		chunkSize = 1;
+
+	unsigned int jobNum = (end - begin + chunkSize - 1) / chunkSize;
+
+	// not worth waking anyone up
+	if (jobs.m_workerNum <= 1 || jobNum == 1) {
+		pFunc(pUserData, begin, end, 0);
+		return;
+	}
+
+	// counted before they are queued, so m_queued never drops below 0
+	jobs.m_pending.store(jobNum);
+	jobs.m_queued.fetch_add(jobNum);
+
+	for (unsigned int w = 0, jobIdx = 0; w < jobs.m_workerNum; ++w) {
+		unsigned int jobEnd = (unsigned int)((unsigned long long)jobNum * (w + 1) / jobs.m_workerNum);
+
+		JobQueue &queue = jobs.m_queues[w];
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		for (; jobIdx < jobEnd; ++jobIdx) {
+			Job job;
+			job.m_pFunc		= pFunc;
+			job.m_pUserData	= pUserData;
+			job.m_begin		= begin + jobIdx * chunkSize;
+			job.m_end		= jobIdx + 1 == jobNum ? end : job.m_begin + chunkSize;
+			queue.m_jobs.push_back(job);
+		}
+	}
+
+	// a worker checks m_queued under m_wakeMutex, so it either sees the
+	// jobs or is already waiting when notified
+	{
+		std::lock_guard<std::mutex> lock(jobs.m_wakeMutex);
+	}
+	jobs.m_wake.notify_all();
+
+	// the caller works as worker 0 until the last job is done
+	Job job;
+	while (jobs.m_pending.load(std::memory_order_acquire) > 0) {
+		if (JobTake(jobs, 0, job))
+			JobRun(jobs, job, 0);
+		else
+			std::this_thread::yield();
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Returns the number of workers, including the calling thread.
+*
+* \param [in]	jobs			Const reference to the JobSystem.
+*
+  \return		unsigned int	number of workers, 0 before JobSystemInit.
+ */
+/******************************************************************************/
+unsigned int JobSystemWorkerNum(const JobSystem &jobs)
+{
+	return jobs.m_workerNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Stops and joins the worker threads.
+*
+* \param [in,out]	jobs		Reference to the JobSystem.
+ */
+/******************************************************************************/
+void JobSystemShutdown(JobSystem &jobs)
+{
+	{
+		std::lock_guard<std::mutex> lock(jobs.m_wakeMutex);
+		jobs.m_quit = true;
+	}
+	jobs.m_wake.notify_all();
+
+	for (size_t i = 0; i < jobs.m_threads.size(); ++i)
+		jobs.m_threads[i].join();
+
+	jobs.m_threads.clear();
+	jobs.m_queues.reset();
+	jobs.m_workerNum = 0;
+	jobs.m_quit = false;
+}
@@ -0,0 +1,149 @@
+/******************************************************************************/
+/*!
+\file		LevelArena.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for LevelArenaInit,
+			LevelArenaAlloc, LevelArenaKeep, LevelArenaReset and
+			LevelArenaRelease.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelArena.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/******************************************************************************/
+/*!
+* \brief Sets an empty arena, the first allocation takes its first block.
+*
+* \param [out]	arena			Reference to LevelArena to be set.
+*
+* \param [in]	blockSize		Least size of a block in bytes, a larger
+								allocation gets a block of its own size.
+ */
+/******************************************************************************/
+void LevelArenaInit(LevelArena &arena,
+	size_t blockSize)
+{
+	LevelArenaRelease(arena);
+	arena.m_blockSize = blockSize;
+}
+
+/******************************************************************************/
+/*!
+* \brief Takes size bytes after the last allocation, or from the next block
+		 that has room for them, adding a block when none has.
+*
+* \param [in,out]	arena		Reference to the LevelArena.
+*
+* \param [in]		size		Size of the allocation in bytes.
+*
+* \param [in]		align		Alignment of the allocation, a power of 2 no
+								larger than alignof(std::max_align_t).
+*
+  \return			void *		Pointer to the zeroed allocation, NULL when
+								the memory ran out.
+ */
+/******************************************************************************/
+void *LevelArenaAlloc(LevelArena &arena,
+	size_t size,
+	size_t align)
+{
+	for (;;) {
+		if (arena.m_blockIdx < arena.m_blocks.size()) {
+			// blocks come from malloc, aligned for any type, so aligning
+			// the offset aligns the address
+			LevelArenaBlock &block = arena.m_blocks[arena.m_blockIdx];
+			size_t offset = (arena.m_used + align - 1) & ~(align - 1);
+
+			if (offset <= block.m_size && size <= block.m_size - offset) {
+				arena.m_used = offset + size;
+				memset(block.m_pData + offset, 0, size);
+				return block.m_pData + offset;
+			}
+
+			// the rest of this block is lost until the next reset
+			++arena.m_blockIdx;
+			arena.m_used = 0;
+			continue;
+		}
+
+		LevelArenaBlock block;
+		block.m_size	= std::max(arena.m_blockSize, size);
+		block.m_pData	= (unsigned char *)malloc(block.m_size);
+		if (!block.m_pData)
+			return NULL;
+
+		arena.m_blocks.push_back(block);
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Marks the allocations made so far as kept by LevelArenaReset.
+*
+* \param [in,out]	arena		Reference to the LevelArena.
+ */
+/******************************************************************************/
+void LevelArenaKeep(LevelArena &arena)
+{
+	arena.m_keepBlockIdx	= arena.m_blockIdx;
+	arena.m_keepUsed		= arena.m_used;
+}
+
+/******************************************************************************/
+/*!
+* \brief Drops every allocation made since LevelArenaKeep. The blocks after
+		 the one the kept allocations end in are merged into one, so that
+		 allocating the same again fits in it without a gap.
+*
+* \param [in,out]	arena		Reference to the LevelArena.
+ */
+/******************************************************************************/
+void LevelArenaReset(LevelArena &arena)
+{
+	size_t first = arena.m_keepBlockIdx + 1;
+
+	if (first + 1 < arena.m_blocks.size()) {
+		LevelArenaBlock merged;
+		merged.m_size = 0;
+		for (size_t i = first; i < arena.m_blocks.size(); ++i)
+			merged.m_size += arena.m_blocks[i].m_size;
+
+		// keep the old blocks when the merged one cannot be had
+		merged.m_pData = (unsigned char *)malloc(merged.m_size);
+		if (merged.m_pData) {
+			for (size_t i = first; i < arena.m_blocks.size(); ++i)
+				free(arena.m_blocks[i].m_pData);
+			arena.m_blocks.resize(first);
+			arena.m_blocks.push_back(merged);
+		}
+	}
+
+	arena.m_blockIdx	= arena.m_keepBlockIdx;
+	arena.m_used		= arena.m_keepUsed;
+}
+
+/******************************************************************************/
+/*!
+* \brief Drops every allocation and gives the blocks back.
+*
+* \param [in,out]	arena		Reference to the LevelArena.
+ */
+/******************************************************************************/
+void LevelArenaRelease(LevelArena &arena)
+{
+	for (size_t i = 0; i < arena.m_blocks.size(); ++i)
+		free(arena.m_blocks[i].m_pData);
+
+	size_t blockSize = arena.m_blockSize;
+	arena = LevelArena();
+	arena.m_blockSize = blockSize;
+}
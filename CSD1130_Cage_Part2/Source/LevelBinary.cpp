@@ -0,0 +1,339 @@
+/******************************************************************************/
+/*!
+\file		LevelBinary.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for LevelBinaryBuild,
+			LevelBinaryWrite, LevelBinaryOpen and LevelBinaryClose.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelBinary.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	// Same value as the engine's PI, level directions are in degree
+	const float			PI_F			= 3.1415926f;
+	const float			PI_OVER_180		= PI_F / 180.0f;
+
+	const unsigned int	ARRAY_ALIGN		= 16;
+
+	unsigned int AlignUp(unsigned int offset)
+	{
+		return (offset + ARRAY_ALIGN - 1) & ~(ARRAY_ALIGN - 1);
+	}
+
+	// Checks that an array of num elements of elementSize lies in the file
+	bool ArrayValid(unsigned int offset, unsigned int num, size_t elementSize, size_t size)
+	{
+		return offset % ARRAY_ALIGN == 0 && offset <= size && num <= (size - offset) / elementSize;
+	}
+
+	/**************************************************************************/
+	/*!
+		Checks the header of the compiled level at pData and points the
+		views of level into it. Returns false if the data is not a
+		compiled level of this build
+	 */
+	/**************************************************************************/
+	bool LevelBinaryBind(LevelBinary &level, const unsigned char *pData, size_t size)
+	{
+		if (size < sizeof(LevelBinaryHeader))
+			return false;
+
+		const LevelBinaryHeader *pHeader = (const LevelBinaryHeader *)pData;
+		if (pHeader->m_magic != LEVEL_BINARY_MAGIC ||
+			pHeader->m_version != LEVEL_BINARY_VERSION ||
+			pHeader->m_size != size ||
+			pHeader->m_circleSize != sizeof(Circle) ||
+			pHeader->m_lineSegmentSize != sizeof(LineSegment))
+			return false;
+
+		unsigned int ballNum = pHeader->m_ballNum, wallNum = pHeader->m_wallNum, pillarNum = pHeader->m_pillarNum;
+		if (!ArrayValid(pHeader->m_ballOffset,		ballNum, sizeof(Circle), size) ||
+			!ArrayValid(pHeader->m_ballVelOffset,	ballNum, sizeof(CSD1130::Vec2), size) ||
+			!ArrayValid(pHeader->m_ballSpeedOffset,	ballNum, sizeof(float), size) ||
+			!ArrayValid(pHeader->m_wallOffset,		wallNum, sizeof(LineSegment), size) ||
+			!ArrayValid(pHeader->m_wallDrawOffset,	wallNum, sizeof(LevelWallDraw), size) ||
+			!ArrayValid(pHeader->m_pillarOffset,	pillarNum, sizeof(Circle), size))
+			return false;
+
+		level.m_pHeader		= pHeader;
+		level.m_pBalls		= (const Circle *)(pData + pHeader->m_ballOffset);
+		level.m_pBallVel	= (const CSD1130::Vec2 *)(pData + pHeader->m_ballVelOffset);
+		level.m_pBallSpeed	= (const float *)(pData + pHeader->m_ballSpeedOffset);
+		level.m_pWalls		= (const LineSegment *)(pData + pHeader->m_wallOffset);
+		level.m_pWallDraw	= (const LevelWallDraw *)(pData + pHeader->m_wallDrawOffset);
+		level.m_pPillars	= (const Circle *)(pData + pHeader->m_pillarOffset);
+		level.m_ballNum		= ballNum;
+		level.m_wallNum		= wallNum;
+		level.m_pillarNum	= pillarNum;
+
+		return true;
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Compiles a level read from a text file in memory: computes the
+		 velocity of each ball, the line segment and drawing transform of
+		 each wall, and the circle of each pillar.
+*
+* \param [out]	level			Reference to LevelBinary to be set.
+*
+* \param [in]	levelData		Const reference to the level read from a
+								text file.
+*
+  \return		bool			returns false if the level is too large for
+								the format.
+ */
+/******************************************************************************/
+bool LevelBinaryBuild(LevelBinary &level,
+	const LevelData &levelData)
+{
+	LevelBinaryClose(level);
+
+	size_t ballNum = levelData.m_balls.size(), wallNum = levelData.m_walls.size(), pillarNum = levelData.m_pillars.size();
+
+	// offsets are 32 bits
+	size_t sizeMax = sizeof(LevelBinaryHeader) + 6 * ARRAY_ALIGN +
+		ballNum * (sizeof(Circle) + sizeof(CSD1130::Vec2) + sizeof(float)) +
+		wallNum * (sizeof(LineSegment) + sizeof(LevelWallDraw)) +
+		pillarNum * sizeof(Circle);
+	if (sizeMax > 0xFFFFFFFFu)
+		return false;
+
+	LevelBinaryHeader header;
+	memset(&header, 0, sizeof(header));
+	header.m_magic				= LEVEL_BINARY_MAGIC;
+	header.m_version			= LEVEL_BINARY_VERSION;
+	header.m_circleSize			= sizeof(Circle);
+	header.m_lineSegmentSize	= sizeof(LineSegment);
+	header.m_ballNum			= (unsigned int)ballNum;
+	header.m_wallNum			= (unsigned int)wallNum;
+	header.m_pillarNum			= (unsigned int)pillarNum;
+	header.m_sourceHash			= levelData.m_sourceHash;
+
+	header.m_ballOffset			= AlignUp(sizeof(LevelBinaryHeader));
+	header.m_ballVelOffset		= AlignUp(header.m_ballOffset + header.m_ballNum * sizeof(Circle));
+	header.m_ballSpeedOffset	= AlignUp(header.m_ballVelOffset + header.m_ballNum * sizeof(CSD1130::Vec2));
+	header.m_wallOffset			= AlignUp(header.m_ballSpeedOffset + header.m_ballNum * sizeof(float));
+	header.m_wallDrawOffset		= AlignUp(header.m_wallOffset + header.m_wallNum * sizeof(LineSegment));
+	header.m_pillarOffset		= AlignUp(header.m_wallDrawOffset + header.m_wallNum * sizeof(LevelWallDraw));
+	header.m_size				= AlignUp(header.m_pillarOffset + header.m_pillarNum * sizeof(Circle));
+
+	level.m_blob.assign(header.m_size, 0);
+	unsigned char *pData = level.m_blob.data();
+	memcpy(pData, &header, sizeof(header));
+
+	Circle			*pBalls		= (Circle *)(pData + header.m_ballOffset);
+	CSD1130::Vec2	*pBallVel	= (CSD1130::Vec2 *)(pData + header.m_ballVelOffset);
+	float			*pBallSpeed	= (float *)(pData + header.m_ballSpeedOffset);
+	LineSegment		*pWalls		= (LineSegment *)(pData + header.m_wallOffset);
+	LevelWallDraw	*pWallDraw	= (LevelWallDraw *)(pData + header.m_wallDrawOffset);
+	Circle			*pPillars	= (Circle *)(pData + header.m_pillarOffset);
+
+	// balls move along their direction at a constant speed
+	for (size_t i = 0; i < ballNum; ++i) {
+		const LevelBall &ball = levelData.m_balls[i];
+
+		pBalls[i].m_center	= ball.m_pos;
+		pBalls[i].m_radius	= ball.m_radius;
+		pBallVel[i]			= CSD1130::Vec2(cosf(ball.m_dir * PI_OVER_180) * ball.m_speed, sinf(ball.m_dir * PI_OVER_180) * ball.m_speed);
+		pBallSpeed[i]		= ball.m_speed;
+	}
+
+	for (size_t i = 0; i < wallNum; ++i) {
+		const CSD1130::Vec2 &P0 = levelData.m_walls[i].m_pt0;
+		const CSD1130::Vec2 &P1 = levelData.m_walls[i].m_pt1;
+		LevelWallDraw &draw = pWallDraw[i];
+
+		BuildLineSegment(pWalls[i], P0, P1);
+
+		// the wall mesh is a unit line along x, centered on the origin
+		CSD1130::Vec2 e;
+		draw.m_pos.x = (P0.x + P1.x) * 0.5f;
+		draw.m_pos.y = (P0.y + P1.y) * 0.5f;
+		e.x = P1.x - P0.x;
+		e.y = P1.y - P0.y;
+		draw.m_scale = sqrtf((e.x * e.x) + (e.y * e.y));
+		//a.b = |a|*|b|*cos(a,b)
+		float cosine = e.x / draw.m_scale;	//assuming scale is non-zero (controlling our data input!)
+		draw.m_angle = acosf(cosine);
+		if (e.y < 0.0f)
+			draw.m_angle = 2 * PI_F - draw.m_angle;
+	}
+
+	for (size_t i = 0; i < pillarNum; ++i) {
+		pPillars[i].m_center	= levelData.m_pillars[i].m_pos;
+		pPillars[i].m_radius	= levelData.m_pillars[i].m_radius;
+	}
+
+	return LevelBinaryBind(level, pData, header.m_size);
+}
+
+/******************************************************************************/
+/*!
+* \brief Writes a compiled level to a file.
+*
+* \param [in]	level			Const reference to the compiled level.
+*
+* \param [in]	pFileName		Path of the file to write.
+*
+  \return		bool			returns false if the file cannot be written.
+ */
+/******************************************************************************/
+bool LevelBinaryWrite(const LevelBinary &level,
+	const char *pFileName)
+{
+	if (!level.m_pHeader)
+		return false;
+
+	std::ofstream outFile(pFileName, std::ios::binary);
+	if (!outFile.is_open())
+		return false;
+
+	outFile.write((const char *)level.m_pHeader, level.m_pHeader->m_size);
+	outFile.close();
+	return !outFile.fail();
+}
+
+/******************************************************************************/
+/*!
+* \brief Memory-maps a compiled level file, read only.
+*
+* \param [out]	level			Reference to LevelBinary to be set.
+*
+* \param [in]	pFileName		Path of the compiled level file.
+*
+  \return		bool			returns false if the file cannot be mapped or
+								is not a compiled level of this build.
+ */
+/******************************************************************************/
+bool LevelBinaryOpen(LevelBinary &level,
+	const char *pFileName)
+{
+	LevelBinaryClose(level);
+
+	void *pMapping = NULL;
+	size_t size = 0;
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+		// the view keeps the mapping alive once both handles are closed
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping) {
+			pMapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			size = (size_t)fileSize.QuadPart;
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+#else
+	int file = open(pFileName, O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0) {
+		pMapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (pMapping == MAP_FAILED)
+			pMapping = NULL;
+		size = (size_t)fileStat.st_size;
+	}
+	close(file);
+#endif
+
+	if (!pMapping)
+		return false;
+
+	level.m_pMapping	= pMapping;
+	level.m_mappingSize	= size;
+
+	if (!LevelBinaryBind(level, (const unsigned char *)pMapping, size)) {
+		LevelBinaryClose(level);
+		return false;
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/*!
+* \brief Copies a compiled level held in memory, e.g. the one saved in a
+		 replay log.
+*
+* \param [out]	level			Reference to LevelBinary to be set.
+*
+* \param [in]	pData			Pointer to the compiled level.
+*
+* \param [in]	size			Size of the compiled level in bytes.
+*
+  \return		bool			returns false if the data is not a compiled
+								level of this build.
+ */
+/******************************************************************************/
+bool LevelBinaryLoad(LevelBinary &level,
+	const unsigned char *pData,
+	size_t size)
+{
+	LevelBinaryClose(level);
+
+	level.m_blob.assign(pData, pData + size);
+
+	if (!LevelBinaryBind(level, level.m_blob.data(), size)) {
+		LevelBinaryClose(level);
+		return false;
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/*!
+* \brief Unmaps or frees a compiled level. Its arrays must not be used
+		 afterwards.
+*
+* \param [in,out]	level		Reference to the LevelBinary.
+ */
+/******************************************************************************/
+void LevelBinaryClose(LevelBinary &level)
+{
+	if (level.m_pMapping) {
+#ifdef _WIN32
+		UnmapViewOfFile(level.m_pMapping);
+#else
+		munmap(level.m_pMapping, level.m_mappingSize);
+#endif
+	}
+
+	level = LevelBinary();
+}
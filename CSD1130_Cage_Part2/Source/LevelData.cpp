@@ -0,0 +1,197 @@
+/******************************************************************************/
+/*!
+\file		LevelData.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains the definitions of LevelDataLoad,
+			LevelDataWrite and LevelDataHashFile.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelData.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	// Reads a whole file as it is on disk, line ends included
+	bool ReadFile(const char *pFileName, std::string &bytes)
+	{
+		std::ifstream inFile(pFileName, std::ios::binary);
+		if (!inFile.is_open())
+			return false;
+
+		inFile.seekg(0, std::ios::end);
+		std::streamoff size = inFile.tellg();
+		inFile.seekg(0, std::ios::beg);
+		if (size < 0)
+			return false;
+
+		bytes.resize((size_t)size);
+		return size == 0 || (bool)inFile.read(&bytes[0], size);
+	}
+
+	// 64 bit FNV-1a, never 0 so that 0 can mean no hash
+	unsigned long long HashBytes(const std::string &bytes)
+	{
+		unsigned long long hash = 14695981039346656037ull;
+		for (size_t i = 0; i < bytes.size(); ++i) {
+			hash ^= (unsigned char)bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash != 0 ? hash : 1;
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Reads a level text file: the number of balls followed by the
+		 position, direction, speed and radius of each ball, then the
+		 number of walls followed by both end points of each wall, then
+		 optionally the number of pillars followed by the position and
+		 radius of each pillar. Every value is preceded by a label that
+		 is skipped. The hash of the file, as LevelDataHashFile computes
+		 it, is kept with the level.
+*
+* \param [out]	level			Reference to LevelData to be filled.
+*
+* \param [in]	pFileName		Path of the level text file.
+*
+  \return		bool			returns false if the file cannot be opened.
+ */
+/******************************************************************************/
+bool LevelDataLoad(LevelData &level,
+	const char *pFileName)
+{
+	level = LevelData();
+
+	std::string bytes;
+	if (!ReadFile(pFileName, bytes))
+		return false;
+
+	level.m_sourceHash = HashBytes(bytes);
+
+	std::istringstream inFile(bytes);
+	std::string str;
+
+	// read ball data
+	unsigned int ballNum = 0;
+	inFile >> ballNum;
+	level.m_balls.resize(ballNum);
+
+	for (unsigned int i = 0; i < ballNum; ++i) {
+		LevelBall &ball = level.m_balls[i];
+
+		inFile >> str >> ball.m_pos.x;
+		inFile >> str >> ball.m_pos.y;
+		inFile >> str >> ball.m_dir;
+		inFile >> str >> ball.m_speed;
+		inFile >> str >> ball.m_radius;
+	}
+
+	// read wall data
+	unsigned int wallNum = 0;
+	inFile >> wallNum;
+	level.m_walls.resize(wallNum);
+
+	for (unsigned int i = 0; i < wallNum; ++i) {
+		LevelWall &wall = level.m_walls[i];
+
+		inFile >> str >> wall.m_pt0.x;
+		inFile >> str >> wall.m_pt0.y;
+		inFile >> str >> wall.m_pt1.x;
+		inFile >> str >> wall.m_pt1.y;
+	}
+
+	// read pillar data, older levels end with the walls
+	unsigned int pillarNum = 0;
+	if (!(inFile >> pillarNum))
+		pillarNum = 0;
+	level.m_pillars.resize(pillarNum);
+
+	for (unsigned int i = 0; i < pillarNum; ++i) {
+		LevelPillar &pillar = level.m_pillars[i];
+
+		inFile >> str >> pillar.m_pos.x;
+		inFile >> str >> pillar.m_pos.y;
+		inFile >> str >> pillar.m_radius;
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/*!
+* \brief Writes a level text file that LevelDataLoad reads back, with the
+		 labels and precision of the shipped levels: positions with 3
+		 decimals, directions, speeds and radii with 2. The pillar section
+		 is only written when there are pillars.
+*
+* \param [in]	level			Const reference to the LevelData to write.
+*
+* \param [in]	pFileName		Path of the level text file.
+*
+  \return		bool			returns false if the file cannot be written.
+ */
+/******************************************************************************/
+bool LevelDataWrite(const LevelData &level,
+	const char *pFileName)
+{
+	std::ofstream outFile(pFileName);
+	if (!outFile.is_open())
+		return false;
+
+	outFile << std::fixed;
+
+	outFile << level.m_balls.size() << "\n";
+	for (const LevelBall &ball : level.m_balls) {
+		outFile << std::setprecision(3) << "PosX: " << ball.m_pos.x << " PosY: " << ball.m_pos.y;
+		outFile << std::setprecision(2) << " Dir: " << ball.m_dir << " Speed: " << ball.m_speed << " Radius: " << ball.m_radius << "\n";
+	}
+
+	outFile << std::setprecision(3);
+	outFile << level.m_walls.size() << "\n";
+	for (const LevelWall &wall : level.m_walls)
+		outFile << "P0X: " << wall.m_pt0.x << " P0Y: " << wall.m_pt0.y << " P1X: " << wall.m_pt1.x << " P1Y: " << wall.m_pt1.y << "\n";
+
+	if (!level.m_pillars.empty()) {
+		outFile << level.m_pillars.size() << "\n";
+		for (const LevelPillar &pillar : level.m_pillars) {
+			outFile << std::setprecision(3) << "PosX: " << pillar.m_pos.x << " PosY: " << pillar.m_pos.y;
+			outFile << std::setprecision(2) << " Radius: " << pillar.m_radius << "\n";
+		}
+	}
+
+	outFile.close();
+	return !outFile.fail();
+}
+
+/******************************************************************************/
+/*!
+* \brief Hashes the bytes of a level file, to tell whether it changed since
+		 a level was read from it without reading it again.
+*
+* \param [in]	pFileName		Path of the level text file.
+*
+* \param [out]	hash			Hash of the file, never 0.
+*
+  \return		bool			returns false if the file cannot be read.
+ */
+/******************************************************************************/
+bool LevelDataHashFile(const char *pFileName,
+	unsigned long long &hash)
+{
+	std::string bytes;
+	if (!ReadFile(pFileName, bytes))
+		return false;
+
+	hash = HashBytes(bytes);
+	return true;
+}
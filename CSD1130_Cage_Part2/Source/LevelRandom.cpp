@@ -0,0 +1,265 @@
+/******************************************************************************/
+/*!
+\file		LevelRandom.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for LevelRandomSizeDefault
+			and LevelRandomGenerate.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelRandom.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	const unsigned int	PLACE_ATTEMPT_MAX	= 100;		// tries to place a ball or a wall before giving up
+	const float			WALL_GAP			= 0.5f;		// least room between a ball and a wall at the start
+	const float			CAGE_THICKNESS		= 1.0f;		// room between the two faces of an inner cage
+	const float			PI_F				= 3.1415926f;
+
+	/**************************************************************************/
+	/*!
+		Items bucketed in square cells, for the overlap checks
+	 */
+	/**************************************************************************/
+	struct BucketGrid
+	{
+		float													m_cellSize;
+		std::unordered_map<long long, std::vector<unsigned int>>	m_cells;
+
+		long long Key(int cellX, int cellY) const
+		{
+			return ((long long)cellX << 32) ^ (long long)(unsigned int)cellY;
+		}
+
+		int Cell(float coord) const
+		{
+			return (int)std::floor(coord / m_cellSize);
+		}
+
+		// Adds idx to every cell the box overlaps
+		void Add(unsigned int idx, float minX, float minY, float maxX, float maxY)
+		{
+			for (int y = Cell(minY); y <= Cell(maxY); ++y)
+				for (int x = Cell(minX); x <= Cell(maxX); ++x)
+					m_cells[Key(x, y)].push_back(idx);
+		}
+
+		// Items of the cells the box overlaps, an item can come more than once
+		template <typename Func>
+		bool Any(float minX, float minY, float maxX, float maxY, Func func) const
+		{
+			for (int y = Cell(minY); y <= Cell(maxY); ++y) {
+				for (int x = Cell(minX); x <= Cell(maxX); ++x) {
+					auto it = m_cells.find(Key(x, y));
+					if (it == m_cells.end())
+						continue;
+					for (unsigned int idx : it->second)
+						if (func(idx))
+							return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	// Uniform in [lo, hi) from the top 24 bits of the engine
+	float Uniform(std::mt19937 &rng, float lo, float hi)
+	{
+		return lo + (hi - lo) * (float)((rng() >> 8) * (1.0 / 16777216.0));
+	}
+
+	// Rounds to the number of decimals the text file keeps
+	float Snap(float value, double scale)
+	{
+		return (float)(std::round(value * scale) / scale);
+	}
+
+	float SnapPos(float value)	{ return Snap(value, 1000.0); }
+	float SnapRest(float value)	{ return Snap(value, 100.0); }
+
+	float SquareDistanceToSegment(const CSD1130::Vec2 &pt, const LevelWall &wall)
+	{
+		CSD1130::Vec2 dir = wall.m_pt1 - wall.m_pt0;
+		float lengthSq = CSD1130::Vector2DSquareLength(dir);
+		float t = lengthSq > 0.0f ? CSD1130::Vector2DDotProduct(pt - wall.m_pt0, dir) / lengthSq : 0.0f;
+		t = std::min(std::max(t, 0.0f), 1.0f);
+		return CSD1130::Vector2DSquareDistance(pt, wall.m_pt0 + dir * t);
+	}
+
+	/**************************************************************************/
+	/*!
+		Adds the walls of a square centered on the origin, each side split
+		in sideNum walls. A wall only stops the balls coming from the side
+		its normal faces: clockwise walls hold the balls inside, the others
+		keep them out
+	 */
+	/**************************************************************************/
+	void AddSquare(LevelData &level, float halfSize, unsigned int sideNum, bool facingIn)
+	{
+		const CSD1130::Vec2 corners[5] = {
+			CSD1130::Vec2(halfSize, -halfSize), CSD1130::Vec2(-halfSize, -halfSize),
+			CSD1130::Vec2(-halfSize, halfSize), CSD1130::Vec2(halfSize, halfSize),
+			CSD1130::Vec2(halfSize, -halfSize) };
+
+		for (int side = 0; side < 4; ++side) {
+			for (unsigned int i = 0; i < sideNum; ++i) {
+				LevelWall wall;
+				CSD1130::Vec2 dir = corners[side + 1] - corners[side];
+				wall.m_pt0 = corners[side] + dir * ((float)i / (float)sideNum);
+				wall.m_pt1 = i + 1 == sideNum ? corners[side + 1] : corners[side] + dir * ((float)(i + 1) / (float)sideNum);
+				wall.m_pt0 = CSD1130::Vec2(SnapPos(wall.m_pt0.x), SnapPos(wall.m_pt0.y));
+				wall.m_pt1 = CSD1130::Vec2(SnapPos(wall.m_pt1.x), SnapPos(wall.m_pt1.y));
+				if (!facingIn)
+					std::swap(wall.m_pt0, wall.m_pt1);
+				level.m_walls.push_back(wall);
+			}
+		}
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Half size of the outer cage that keeps the density of the shipped
+		 levels, 500 balls in a cage of half size 400, and is never smaller
+		 than that cage.
+*
+* \param [in]	ballNum			Number of balls of the level.
+*
+  \return		float			returns the half size.
+ */
+/******************************************************************************/
+float LevelRandomSizeDefault(unsigned int ballNum)
+{
+	return 400.0f * std::sqrt(std::max((float)ballNum / 500.0f, 1.0f));
+}
+
+/******************************************************************************/
+/*!
+* \brief Generates a level: the cages, the loose walls, then the balls.
+*
+* \param [out]	level			Reference to LevelData to be filled.
+*
+* \param [in]	settings		Const reference to the generator settings.
+*
+  \return		bool			returns false if there is no cage, or if a
+								ball or a wall could not be placed, the level
+								is then too dense.
+ */
+/******************************************************************************/
+bool LevelRandomGenerate(LevelData &level,
+	const LevelRandomSettings &settings)
+{
+	std::mt19937 rng(settings.m_seed);
+	level = LevelData();
+
+	if (settings.m_cageNum == 0 || settings.m_sideNum == 0)
+		return false;
+
+	// the outer cage faces in, an inner cage has a face out for the balls
+	// around it and, a bit inside, a face in for the balls it holds. Two
+	// faces on the same line would catch a ball leaving the other one
+	float size = settings.m_size > 0.0f ? settings.m_size : LevelRandomSizeDefault(settings.m_ballNum);
+	std::vector<float> cageHalfSizes;
+	for (unsigned int k = 0; k < settings.m_cageNum; ++k) {
+		float halfSize = SnapPos(size * (float)(settings.m_cageNum - k) / (float)settings.m_cageNum);
+		if (k > 0) {
+			AddSquare(level, halfSize, settings.m_sideNum, false);
+			cageHalfSizes.push_back(halfSize);
+			halfSize -= CAGE_THICKNESS;
+		}
+		AddSquare(level, halfSize, settings.m_sideNum, true);
+		cageHalfSizes.push_back(halfSize);
+	}
+
+	// loose walls, both ends inside the outer cage
+	unsigned int cageWallNum = (unsigned int)level.m_walls.size();
+	float logMin = std::log(settings.m_lengthMin), logMax = std::log(settings.m_lengthMax);
+
+	for (unsigned int i = 0; i < settings.m_wallNum; ++i) {
+		unsigned int attempt = 0;
+		for (; attempt < PLACE_ATTEMPT_MAX; ++attempt) {
+			CSD1130::Vec2 pt0(Uniform(rng, -size, size), Uniform(rng, -size, size));
+			float angle = Uniform(rng, 0.0f, 2.0f * PI_F);
+			float length = settings.m_logLength ? std::exp(Uniform(rng, logMin, logMax))
+												: Uniform(rng, settings.m_lengthMin, settings.m_lengthMax);
+			CSD1130::Vec2 pt1 = pt0 + CSD1130::Vec2(std::cos(angle), std::sin(angle)) * length;
+
+			if (std::fabs(pt1.x) < size && std::fabs(pt1.y) < size) {
+				LevelWall wall;
+				wall.m_pt0 = CSD1130::Vec2(SnapPos(pt0.x), SnapPos(pt0.y));
+				wall.m_pt1 = CSD1130::Vec2(SnapPos(pt1.x), SnapPos(pt1.y));
+				level.m_walls.push_back(wall);
+				break;
+			}
+		}
+		if (attempt == PLACE_ATTEMPT_MAX)
+			return false;
+	}
+
+	// balls must start clear of the walls and of each other
+	float reach = settings.m_radiusMax + WALL_GAP;
+
+	BucketGrid wallGrid{ std::max(settings.m_lengthMax, 2.0f * reach), {} };
+	for (unsigned int i = cageWallNum; i < level.m_walls.size(); ++i) {
+		const LevelWall &wall = level.m_walls[i];
+		wallGrid.Add(i,
+			std::min(wall.m_pt0.x, wall.m_pt1.x) - reach, std::min(wall.m_pt0.y, wall.m_pt1.y) - reach,
+			std::max(wall.m_pt0.x, wall.m_pt1.x) + reach, std::max(wall.m_pt0.y, wall.m_pt1.y) + reach);
+	}
+
+	BucketGrid ballGrid{ 2.0f * settings.m_radiusMax, {} };
+	level.m_balls.reserve(settings.m_ballNum);
+
+	for (unsigned int i = 0; i < settings.m_ballNum; ++i) {
+		LevelBall ball;
+		ball.m_dir		= SnapRest(Uniform(rng, 0.0f, 360.0f));
+		ball.m_speed	= SnapRest(Uniform(rng, settings.m_speedMin, settings.m_speedMax));
+		ball.m_radius	= SnapRest(Uniform(rng, settings.m_radiusMin, settings.m_radiusMax));
+
+		float r = ball.m_radius, clear = r + WALL_GAP;
+		unsigned int attempt = 0;
+		for (; attempt < PLACE_ATTEMPT_MAX; ++attempt) {
+			ball.m_pos = CSD1130::Vec2(SnapPos(Uniform(rng, -size + clear, size - clear)),
+										SnapPos(Uniform(rng, -size + clear, size - clear)));
+
+			// the cages are squares, the distance to their border is the
+			// difference of the Chebyshev norms (less at the corners)
+			float norm = std::max(std::fabs(ball.m_pos.x), std::fabs(ball.m_pos.y));
+			bool blocked = false;
+			for (float halfSize : cageHalfSizes)
+				blocked = blocked || std::fabs(norm - halfSize) < clear;
+
+			blocked = blocked || wallGrid.Any(ball.m_pos.x, ball.m_pos.y, ball.m_pos.x, ball.m_pos.y,
+				[&](unsigned int idx) { return SquareDistanceToSegment(ball.m_pos, level.m_walls[idx]) < clear * clear; });
+
+			// a ball touches the others up to r + m_radiusMax away
+			float touchMax = r + settings.m_radiusMax;
+			blocked = blocked || ballGrid.Any(ball.m_pos.x - touchMax, ball.m_pos.y - touchMax, ball.m_pos.x + touchMax, ball.m_pos.y + touchMax,
+				[&](unsigned int idx) {
+					const LevelBall &other = level.m_balls[idx];
+					float touch = r + other.m_radius;
+					return CSD1130::Vector2DSquareDistance(ball.m_pos, other.m_pos) < touch * touch; });
+
+			if (!blocked)
+				break;
+		}
+		if (attempt == PLACE_ATTEMPT_MAX)
+			return false;
+
+		ballGrid.Add(i, ball.m_pos.x, ball.m_pos.y, ball.m_pos.x, ball.m_pos.y);
+		level.m_balls.push_back(ball);
+	}
+
+	return true;
+}
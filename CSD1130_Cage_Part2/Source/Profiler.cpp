@@ -0,0 +1,226 @@
+/******************************************************************************/
+/*!
+\file		Profiler.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for ProfilerInit,
+			ProfilerEnable, ProfilerFrameBegin, ProfilerScopeBegin,
+			ProfilerScopeEnd, ProfilerWriteChromeTrace and
+			ProfilerShutdown.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "Profiler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+namespace
+{
+	typedef std::chrono::steady_clock	Clock;
+
+	struct ProfilerEvent
+	{
+		const char		*m_pName;
+		long long		m_start;				// in ns since ProfilerInit
+		long long		m_end;					// -1 while the scope is open
+	};
+
+	struct ProfilerFrame
+	{
+		long long		m_start;
+		unsigned int	m_eventNum;
+		ProfilerEvent	m_events[PROFILER_FRAME_EVENT_MAX];
+	};
+
+	std::vector<ProfilerFrame>	sFrames;		// ring buffer
+	unsigned long long			sFrameCount	= 0;	// frames begun since ProfilerInit
+	bool						sEnabled	= false;
+	Clock::time_point			sEpoch;
+
+	long long Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sEpoch).count();
+	}
+
+	ProfilerFrame &CurrentFrame()
+	{
+		return sFrames[(sFrameCount - 1) % PROFILER_FRAME_NUM];
+	}
+
+	// Writes one complete ("X") trace event, times in us
+	void WriteEvent(std::ofstream &outFile, bool &first, const char *pName, long long start, long long end)
+	{
+		outFile << (first ? "\n" : ",\n");
+		outFile << "{\"name\":\"" << pName << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+			<< ",\"ts\":" << start / 1000.0 << ",\"dur\":" << (end - start) / 1000.0 << "}";
+		first = false;
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Allocates the ring buffer and starts the clock.
+*
+* \param [in]	enabled			Flag to determine whether scopes are recorded
+								from now on.
+ */
+/******************************************************************************/
+void ProfilerInit(bool enabled)
+{
+	sFrames.assign(PROFILER_FRAME_NUM, ProfilerFrame());
+	sFrameCount	= 0;
+	sEnabled	= enabled;
+	sEpoch		= Clock::now();
+}
+
+/******************************************************************************/
+/*!
+* \brief Turns recording on or off. The frames recorded so far are kept.
+*
+* \param [in]	enabled			Flag to determine whether scopes are recorded.
+ */
+/******************************************************************************/
+void ProfilerEnable(bool enabled)
+{
+	sEnabled = enabled && !sFrames.empty();
+}
+
+/******************************************************************************/
+/*!
+* \brief Starts a new frame, overwriting the oldest one once the ring buffer
+		 is full.
+ */
+/******************************************************************************/
+void ProfilerFrameBegin(void)
+{
+	if (!sEnabled)
+		return;
+
+	++sFrameCount;
+	ProfilerFrame &frame = CurrentFrame();
+	frame.m_start		= Now();
+	frame.m_eventNum	= 0;
+}
+
+/******************************************************************************/
+/*!
+* \brief Opens a scope in the current frame.
+*
+* \param [in]	pName			Name of the scope. It is stored, not copied.
+*
+  \return		long long		the frame and the index of the scope in it,
+								frame * PROFILER_FRAME_EVENT_MAX + index, -1
+								if it is not recorded.
+ */
+/******************************************************************************/
+long long ProfilerScopeBegin(const char *pName)
+{
+	if (!sEnabled || sFrameCount == 0)
+		return -1;
+
+	ProfilerFrame &frame = CurrentFrame();
+	if (frame.m_eventNum >= PROFILER_FRAME_EVENT_MAX)
+		return -1;
+
+	ProfilerEvent &event = frame.m_events[frame.m_eventNum];
+	event.m_pName	= pName;
+	event.m_end		= -1;
+	event.m_start	= Now();
+
+	return (long long)sFrameCount * PROFILER_FRAME_EVENT_MAX + frame.m_eventNum++;
+}
+
+/******************************************************************************/
+/*!
+* \brief Closes a scope opened by ProfilerScopeBegin.
+*
+* \param [in]	scopeId			Value returned by ProfilerScopeBegin.
+ */
+/******************************************************************************/
+void ProfilerScopeEnd(long long scopeId)
+{
+	if (scopeId < 0 || sFrameCount == 0)
+		return;
+
+	long long end = Now();
+
+	// ignore scopes left open across ProfilerFrameBegin, their frame is
+	// no longer the current one
+	if ((unsigned long long)scopeId / PROFILER_FRAME_EVENT_MAX != sFrameCount)
+		return;
+
+	ProfilerFrame &frame = CurrentFrame();
+	unsigned int eventIdx = (unsigned int)(scopeId % PROFILER_FRAME_EVENT_MAX);
+	if (eventIdx < frame.m_eventNum)
+		frame.m_events[eventIdx].m_end = end;
+}
+
+/******************************************************************************/
+/*!
+* \brief Saves the frames of the ring buffer, oldest first, as a Chrome
+		 trace-event JSON file. Each frame is an event named "Frame" that
+		 lasts until the next frame begins, with its scopes nested in it.
+*
+* \param [in]	pFileName		Path of the JSON file to write.
+*
+  \return		bool			returns false if the file cannot be written.
+ */
+/******************************************************************************/
+bool ProfilerWriteChromeTrace(const char *pFileName)
+{
+	std::ofstream outFile(pFileName);
+	if (!outFile.is_open())
+		return false;
+
+	outFile << std::fixed << std::setprecision(3);
+	outFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	unsigned long long frameNum = sFrameCount < PROFILER_FRAME_NUM ? sFrameCount : PROFILER_FRAME_NUM;
+	bool first = true;
+
+	for (unsigned long long f = sFrameCount - frameNum; f < sFrameCount; ++f) {
+		const ProfilerFrame &frame = sFrames[f % PROFILER_FRAME_NUM];
+
+		// the last frame ends with its last scope
+		long long frameEnd = frame.m_start;
+		if (f + 1 < sFrameCount)
+			frameEnd = sFrames[(f + 1) % PROFILER_FRAME_NUM].m_start;
+		else {
+			for (unsigned int i = 0; i < frame.m_eventNum; ++i)
+				if (frame.m_events[i].m_end > frameEnd)
+					frameEnd = frame.m_events[i].m_end;
+		}
+
+		WriteEvent(outFile, first, "Frame", frame.m_start, frameEnd);
+
+		for (unsigned int i = 0; i < frame.m_eventNum; ++i) {
+			const ProfilerEvent &event = frame.m_events[i];
+			if (event.m_end >= 0)
+				WriteEvent(outFile, first, event.m_pName, event.m_start, event.m_end);
+		}
+	}
+
+	outFile << "\n]}\n";
+	outFile.close();
+	return !outFile.fail();
+}
+
+/******************************************************************************/
+/*!
+* \brief Stops recording and frees the ring buffer.
+ */
+/******************************************************************************/
+void ProfilerShutdown(void)
+{
+	sFrames.clear();
+	sFrames.shrink_to_fit();
+	sFrameCount	= 0;
+	sEnabled	= false;
+}
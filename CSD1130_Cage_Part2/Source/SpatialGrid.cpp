@@ -0,0 +1,272 @@
+/******************************************************************************/
+/*!
+\file		SpatialGrid.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for SpatialGridBuild,
+			SpatialGridQuery and SpatialGridClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// Upper bound on the number of cells per segment, keeps the grid memory
+	// linear in the number of walls even for very uneven wall lengths
+	const unsigned int	GRID_CELLS_PER_SEGMENT_MAX	= 4;
+
+	// Enlarges the cell/segment test a little so that round-off never drops
+	// a segment that only grazes a cell
+	const float			GRID_CELL_SLACK				= 1.0e-3f;
+
+	/**************************************************************************/
+	/*!
+		Converts a world coordinate to a cell coordinate clamped to the grid,
+		NaN goes to the first cell
+	 */
+	/**************************************************************************/
+	int CellCoord(float value, float origin, float invCellSize, int cellNum)
+	{
+		// Clamp before the conversion so far away points cannot overflow.
+		// std::max does not clamp NaN, the comparison below does
+		float cell = floorf((value - origin) * invCellSize);
+		if (!(cell >= 0.0f))
+			return 0;
+		return (int)std::min(cell, (float)(cellNum - 1));
+	}
+
+	/**************************************************************************/
+	/*!
+		Returns true if the infinite line through lineSeg crosses the square
+		cell whose center is cellCenter.
+	 */
+	/**************************************************************************/
+	bool SegmentTouchesCell(const LineSegment &lineSeg,
+		const CSD1130::Vec2 &cellCenter,
+		float halfSize)
+	{
+		// Distance from the cell center to the line against the projected
+		// half extent of the cell on the line normal
+		float dist		= CSD1130::Vector2DDotProduct(lineSeg.m_normal, cellCenter - lineSeg.m_pt0);
+		float extent	= halfSize * (fabsf(lineSeg.m_normal.x) + fabsf(lineSeg.m_normal.y));
+
+		return fabsf(dist) <= extent;
+	}
+
+	/**************************************************************************/
+	/*!
+		Returns true if circle overlaps the square cell whose center is
+		cellCenter.
+	 */
+	/**************************************************************************/
+	bool CircleTouchesCell(const Circle &circle,
+		const CSD1130::Vec2 &cellCenter,
+		float halfSize)
+	{
+		// Distance from the circle center to the closest point of the cell
+		float dx = std::max(fabsf(circle.m_center.x - cellCenter.x) - halfSize, 0.0f);
+		float dy = std::max(fabsf(circle.m_center.y - cellCenter.y) - halfSize, 0.0f);
+
+		return dx * dx + dy * dy <= circle.m_radius * circle.m_radius;
+	}
+
+	/**************************************************************************/
+	/*!
+		Bounding box of item i: the segments come first, then the circles
+	 */
+	/**************************************************************************/
+	void ItemAABB(AABB &aabb, unsigned int i,
+		const LineSegment *pSegments, unsigned int segmentNum, const Circle *pCircles)
+	{
+		if (i < segmentNum)
+			BuildAABB(aabb, pSegments[i]);
+		else
+			BuildAABB(aabb, pCircles[i - segmentNum]);
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Builds the grid over static arrays of line segments and circles.
+		 Circle i is stored as item segmentNum + i.
+*
+* \param [out]	grid			Reference to SpatialGrid to be built.
+*
+* \param [in]	pSegments		Pointer to the first line segment.
+*
+* \param [in]	segmentNum		Number of line segments in pSegments.
+*
+* \param [in]	pCircles		Pointer to the first circle.
+*
+* \param [in]	circleNum		Number of circles in pCircles.
+ */
+/******************************************************************************/
+void SpatialGridBuild(SpatialGrid &grid,
+	const LineSegment *pSegments,
+	unsigned int segmentNum,
+	const Circle *pCircles,
+	unsigned int circleNum)
+{
+	SpatialGridClear(grid);
+
+	unsigned int itemNum = segmentNum + circleNum;
+	if (itemNum == 0)
+		return;
+
+	// Compute the bounds of the level and the average item extent
+	AABB bounds, aabb;
+	float extentSum = 0.0f;
+
+	ItemAABB(bounds, 0, pSegments, segmentNum, pCircles);
+	for (unsigned int i = 0; i < itemNum; ++i) {
+		ItemAABB(aabb, i, pSegments, segmentNum, pCircles);
+		bounds.m_min.x = std::min(bounds.m_min.x, aabb.m_min.x);
+		bounds.m_min.y = std::min(bounds.m_min.y, aabb.m_min.y);
+		bounds.m_max.x = std::max(bounds.m_max.x, aabb.m_max.x);
+		bounds.m_max.y = std::max(bounds.m_max.y, aabb.m_max.y);
+		extentSum += std::max(aabb.m_max.x - aabb.m_min.x, aabb.m_max.y - aabb.m_min.y);
+	}
+
+	float width		= bounds.m_max.x - bounds.m_min.x;
+	float height	= bounds.m_max.y - bounds.m_min.y;
+
+	// A cell roughly the size of an average wall keeps the number of walls
+	// per cell, and of cells per wall, small
+	float cellSize = extentSum / (float)itemNum;
+	if (cellSize <= 0.0f)
+		cellSize = std::max(std::max(width, height), 1.0f);
+
+	// Do not let a few tiny walls explode the cell count
+	float cellNumMax = (float)(GRID_CELLS_PER_SEGMENT_MAX * itemNum);
+	float cellNum = (width / cellSize + 1.0f) * (height / cellSize + 1.0f);
+	if (cellNum > cellNumMax)
+		cellSize *= sqrtf(cellNum / cellNumMax);
+
+	grid.m_origin		= bounds.m_min;
+	grid.m_cellSize		= cellSize;
+	grid.m_invCellSize	= 1.0f / cellSize;
+	grid.m_cols			= (int)(width * grid.m_invCellSize) + 1;
+	grid.m_rows			= (int)(height * grid.m_invCellSize) + 1;
+
+	// Two passes: count the segments per cell, then scatter them into the
+	// flat item array
+	std::vector<unsigned int> &cellStart = grid.m_cellStart;
+	cellStart.assign((size_t)grid.m_cols * grid.m_rows + 1, 0);
+
+	float halfSize = 0.5f * cellSize * (1.0f + GRID_CELL_SLACK);
+
+	for (int pass = 0; pass < 2; ++pass) {
+		for (unsigned int i = 0; i < itemNum; ++i) {
+			ItemAABB(aabb, i, pSegments, segmentNum, pCircles);
+
+			int col0 = CellCoord(aabb.m_min.x, grid.m_origin.x, grid.m_invCellSize, grid.m_cols);
+			int col1 = CellCoord(aabb.m_max.x, grid.m_origin.x, grid.m_invCellSize, grid.m_cols);
+			int row0 = CellCoord(aabb.m_min.y, grid.m_origin.y, grid.m_invCellSize, grid.m_rows);
+			int row1 = CellCoord(aabb.m_max.y, grid.m_origin.y, grid.m_invCellSize, grid.m_rows);
+
+			for (int row = row0; row <= row1; ++row) {
+				for (int col = col0; col <= col1; ++col) {
+					CSD1130::Vec2 cellCenter(grid.m_origin.x + ((float)col + 0.5f) * cellSize,
+											 grid.m_origin.y + ((float)row + 0.5f) * cellSize);
+
+					// Long diagonal walls only go into the cells they cross,
+					// circles skip the corner cells of their box
+					if (i < segmentNum ? !SegmentTouchesCell(pSegments[i], cellCenter, halfSize)
+									   : !CircleTouchesCell(pCircles[i - segmentNum], cellCenter, halfSize))
+						continue;
+
+					size_t cell = (size_t)row * grid.m_cols + col;
+					if (pass == 0)
+						++cellStart[cell + 1];
+					else
+						grid.m_items[cellStart[cell]++] = i;
+				}
+			}
+		}
+
+		if (pass == 0) {
+			// Prefix sum into start offsets
+			for (size_t c = 1; c < cellStart.size(); ++c)
+				cellStart[c] += cellStart[c - 1];
+			grid.m_items.resize(cellStart.back());
+		}
+		else {
+			// The scatter advanced every start to the next cell's start
+			for (size_t c = cellStart.size() - 1; c > 0; --c)
+				cellStart[c] = cellStart[c - 1];
+			cellStart[0] = 0;
+		}
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Collects the items stored in every cell overlapped by a box.
+*
+* \param [in]	grid			Const reference to a built SpatialGrid.
+*
+* \param [in]	aabb			Const reference to the query box, usually
+								built from a swept circle with BuildAABB.
+*
+* \param [out]	result			Cleared, then filled with the candidate
+								item indices in increasing order without
+								duplicates.
+ */
+/******************************************************************************/
+void SpatialGridQuery(const SpatialGrid &grid,
+	const AABB &aabb,
+	std::vector<unsigned int> &result)
+{
+	result.clear();
+
+	if (grid.m_cellStart.empty())
+		return;
+
+	// Reject boxes with a NaN bound, the tests below let them through
+	if (!(aabb.m_min.x <= aabb.m_max.x) || !(aabb.m_min.y <= aabb.m_max.y))
+		return;
+
+	// Reject boxes that lie completely outside of the grid
+	float right	= grid.m_origin.x + (float)grid.m_cols * grid.m_cellSize;
+	float top	= grid.m_origin.y + (float)grid.m_rows * grid.m_cellSize;
+	if (aabb.m_max.x < grid.m_origin.x || aabb.m_min.x > right ||
+		aabb.m_max.y < grid.m_origin.y || aabb.m_min.y > top)
+		return;
+
+	int col0 = CellCoord(aabb.m_min.x, grid.m_origin.x, grid.m_invCellSize, grid.m_cols);
+	int col1 = CellCoord(aabb.m_max.x, grid.m_origin.x, grid.m_invCellSize, grid.m_cols);
+	int row0 = CellCoord(aabb.m_min.y, grid.m_origin.y, grid.m_invCellSize, grid.m_rows);
+	int row1 = CellCoord(aabb.m_max.y, grid.m_origin.y, grid.m_invCellSize, grid.m_rows);
+
+	for (int row = row0; row <= row1; ++row) {
+		size_t cell = (size_t)row * grid.m_cols;
+		unsigned int begin	= grid.m_cellStart[cell + col0];
+		unsigned int end	= grid.m_cellStart[cell + col1 + 1];
+		result.insert(result.end(), grid.m_items.begin() + begin, grid.m_items.begin() + end);
+	}
+
+	// Walls spanning several cells show up more than once. Keeping them in
+	// increasing order also preserves the order walls are resolved in.
+	std::sort(result.begin(), result.end());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+/******************************************************************************/
+/*!
+* \brief Releases the memory held by a grid and resets it to empty.
+*
+* \param [in,out]	grid		Reference to SpatialGrid to be cleared.
+ */
+/******************************************************************************/
+void SpatialGridClear(SpatialGrid &grid)
+{
+	grid = SpatialGrid();
+}
@@ -0,0 +1,224 @@
+/******************************************************************************/
+/*!
+\file		SweepAndPrune.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		This source file contains definitions for SweepAndPruneUpdate,
+			SweepAndPruneFindPairs and SweepAndPruneClear.
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "SweepAndPrune.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	bool EntryLess(const SweepAndPruneEntry &lhs, const SweepAndPruneEntry &rhs)
+	{
+		return lhs.m_minX < rhs.m_minX || (lhs.m_minX == rhs.m_minX && lhs.m_idx < rhs.m_idx);
+	}
+
+	void SetBounds(SweepAndPruneEntry &entry, const float *pPosX, const float *pPosY, const float *pRadius)
+	{
+		unsigned int i = entry.m_idx;
+		entry.m_minX = pPosX[i] - pRadius[i];
+		entry.m_maxX = pPosX[i] + pRadius[i];
+		entry.m_minY = pPosY[i] - pRadius[i];
+		entry.m_maxY = pPosY[i] + pRadius[i];
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Refreshes the bounds of every circle and sorts them again. When the
+		 number of circles changed, the order is rebuilt from scratch,
+		 otherwise the order of the last update is fixed by insertion sort.
+*
+* \param [in,out]	sap			Reference to the SweepAndPrune.
+*
+* \param [in]		pPosX		Pointer to the x of the circle centers.
+*
+* \param [in]		pPosY		Pointer to the y of the circle centers.
+*
+* \param [in]		pRadius		Pointer to the circle radii.
+*
+* \param [in]		count		Number of circles.
+ */
+/******************************************************************************/
+void SweepAndPruneUpdate(SweepAndPrune &sap,
+	const float *pPosX,
+	const float *pPosY,
+	const float *pRadius,
+	unsigned int count)
+{
+	std::vector<SweepAndPruneEntry> &entries = sap.m_entries;
+
+	if (entries.size() != count) {
+		entries.resize(count);
+		for (unsigned int i = 0; i < count; ++i) {
+			entries[i].m_idx = i;
+			SetBounds(entries[i], pPosX, pPosY, pRadius);
+		}
+		std::sort(entries.begin(), entries.end(), EntryLess);
+		sap.m_swapNum = 0;
+		return;
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+		SetBounds(entries[i], pPosX, pPosY, pRadius);
+
+	// each entry moves down past the ones that now start after it
+	unsigned long long swapNum = 0;
+	for (unsigned int i = 1; i < count; ++i) {
+		if (!EntryLess(entries[i], entries[i - 1]))
+			continue;
+
+		SweepAndPruneEntry entry = entries[i];
+		unsigned int j = i;
+		do {
+			entries[j] = entries[j - 1];
+			--j;
+		} while (j > 0 && EntryLess(entry, entries[j - 1]));
+		entries[j] = entry;
+		swapNum += i - j;
+	}
+	sap.m_swapNum += swapNum;
+}
+
+/******************************************************************************/
+/*!
+* \brief Collects the pairs of circles whose bounding boxes overlap
+		 (touching counts), band by band in sweep order.
+*
+* \param [in,out]	sap			Reference to the SweepAndPrune, updated since
+								the circles last moved. Only its scratch
+								buffers are written.
+*
+* \param [out]		pairs		Cleared, then filled with the circle indices
+								of each pair, one after the other.
+ */
+/******************************************************************************/
+void SweepAndPruneFindPairs(SweepAndPrune &sap,
+	std::vector<unsigned int> &pairs)
+{
+	pairs.clear();
+
+	const std::vector<SweepAndPruneEntry> &entries = sap.m_entries;
+	unsigned int count = (unsigned int)entries.size();
+	if (count == 0)
+		return;
+
+	// Bands are as high as the highest box, so boxes that overlap start in
+	// the same band or in two neighbouring ones
+	float minY = entries[0].m_minY, maxY = entries[0].m_minY, bandHeight = 0.0f;
+	for (unsigned int i = 0; i < count; ++i) {
+		minY		= std::min(minY, entries[i].m_minY);
+		maxY		= std::max(maxY, entries[i].m_minY);
+		bandHeight	= std::max(bandHeight, entries[i].m_maxY - entries[i].m_minY);
+	}
+
+	// no more bands than circles, whatever the spread
+	unsigned int bandNum = 1;
+	if (bandHeight > 0.0f) {
+		float bands = std::floor((maxY - minY) / bandHeight) + 1.0f;
+		bandNum = bands < (float)count ? (unsigned int)bands : count;
+		bandHeight = std::max(bandHeight, (maxY - minY) / (float)bandNum);
+	}
+
+	// a little higher, so that rounding never puts touching boxes two bands apart
+	bandHeight *= 1.0f + 1.0e-4f;
+	float invBandHeight = bandHeight > 0.0f ? 1.0f / bandHeight : 0.0f;
+
+	// Counting sort on the band, stable so each band stays sorted by m_minX
+	std::vector<unsigned int> &bandStart = sap.m_bandStart;
+	bandStart.assign(bandNum + 1, 0);
+
+	std::vector<unsigned int> &bands = sap.m_bands;
+	bands.resize(count);
+	for (unsigned int i = 0; i < count; ++i) {
+		unsigned int band = (unsigned int)((entries[i].m_minY - minY) * invBandHeight);
+		bands[i] = band < bandNum ? band : bandNum - 1;
+		++bandStart[bands[i] + 1];
+	}
+	for (unsigned int b = 0; b < bandNum; ++b)
+		bandStart[b + 1] += bandStart[b];
+
+	std::vector<SweepAndPruneEntry> &banded = sap.m_banded;
+	banded.resize(count);
+	std::vector<unsigned int> &next = sap.m_bandNext;
+	next.assign(bandStart.begin(), bandStart.end() - 1);
+	for (unsigned int i = 0; i < count; ++i)
+		banded[next[bands[i]]++] = entries[i];
+
+	const SweepAndPruneEntry *pEntries = banded.data();
+
+	for (unsigned int b = 0; b < bandNum; ++b) {
+		unsigned int begin = bandStart[b], end = bandStart[b + 1];
+
+		// Within the band: the entries after i start after it, stop at the
+		// first one that starts after i ends
+		for (unsigned int i = begin; i < end; ++i) {
+			const SweepAndPruneEntry &entry = pEntries[i];
+			for (unsigned int j = i + 1; j < end && pEntries[j].m_minX <= entry.m_maxX; ++j) {
+				const SweepAndPruneEntry &other = pEntries[j];
+				if (other.m_minY <= entry.m_maxY && entry.m_minY <= other.m_maxY) {
+					pairs.push_back(entry.m_idx);
+					pairs.push_back(other.m_idx);
+				}
+			}
+		}
+
+		if (b + 1 == bandNum)
+			continue;
+
+		// Against the next band: walk both in merged order, each entry is
+		// swept against the entries of the other band that start after it
+		unsigned int i = begin, k = end, kEnd = bandStart[b + 2];
+		while (i < end && k < kEnd) {
+			bool fromThis = !EntryLess(pEntries[k], pEntries[i]);
+			const SweepAndPruneEntry &entry = fromThis ? pEntries[i] : pEntries[k];
+			unsigned int j = fromThis ? k : i, jEnd = fromThis ? kEnd : end;
+
+			for (; j < jEnd && pEntries[j].m_minX <= entry.m_maxX; ++j) {
+				const SweepAndPruneEntry &other = pEntries[j];
+				if (other.m_minY <= entry.m_maxY && entry.m_minY <= other.m_maxY) {
+					pairs.push_back(entry.m_idx);
+					pairs.push_back(other.m_idx);
+				}
+			}
+
+			if (fromThis)
+				++i;
+			else
+				++k;
+		}
+	}
+}
+
+/******************************************************************************/
+/*!
+* \brief Releases the entries and the scratch buffers.
+*
+* \param [in,out]	sap			Reference to the SweepAndPrune.
+ */
+/******************************************************************************/
+void SweepAndPruneClear(SweepAndPrune &sap)
+{
+	sap.m_entries.clear();
+	sap.m_entries.shrink_to_fit();
+	sap.m_swapNum = 0;
+	sap.m_banded.clear();
+	sap.m_banded.shrink_to_fit();
+	sap.m_bandStart.clear();
+	sap.m_bandStart.shrink_to_fit();
+	sap.m_bands.clear();
+	sap.m_bands.shrink_to_fit();
+	sap.m_bandNext.clear();
+	sap.m_bandNext.shrink_to_fit();
+}
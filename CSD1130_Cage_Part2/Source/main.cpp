@@ -80,12 +80,9 @@ int WINAPI WinMain(_In_ HINSTANCE instanceH, _In_opt_ HINSTANCE prevInstanceH, _
 			if ((AESysDoesWindowExist() == false) || AEInputCheckTriggered(AEVK_ESCAPE))
 				gGameStateNext = GS_STATE::GS_QUIT;
 
+			// the real frame time, the game states simulate it in fixed steps
 			g_dt = (f32)AEFrameRateControllerGetFrameTime();
 
-			//hack
-			if (g_dt > 0.01667f)
-				g_dt = 0.01667f;
-			
 			g_appTime += g_dt;
 		}
 		
@@ -0,0 +1,273 @@
+/******************************************************************************/
+/*!
+\file		CageHeadless.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Runs the Cage simulation of a level file (text or compiled by
+			LevelCompiler) without AlphaEngine, for a fixed number of frames
+			at a fixed time step, and reports the time spent loading and
+			stepping together with a checksum of the final ball state, so
+			that runs can be timed and compared across changes.
+
+			Usage:
+			CageHeadless <level file> [-frames N] [-dt seconds]
+						 [-broadphase 0|1] [-collision 0|1|2] [-edges 0|1]
+						 [-balls 0|1] [-threads N] [-dump] [-trace file.json]
+						 [-record log.bin]
+			CageHeadless <replay log> -replay [-threads N] [-dump]
+						 [-trace file.json]
+
+			-frames		number of steps (default 1000)
+			-dt			time step (default 1/60)
+			-broadphase	0: uniform grid, 1: BVH (default 1)
+			-collision	0: walls in index order, 1: continuous collision,
+						earliest impact first, 2: event driven (default 0)
+			-edges		collide with the line segment edges (default 1)
+			-balls		collide balls with each other (default 0)
+			-threads	workers sharing the ball update, 0 for one per
+						hardware thread (default 1)
+			-dump		print the final position and velocity of each ball
+			-trace		save the phases of the last frames as a Chrome trace
+			-record		save the run as a replay log, one step per frame
+			-replay		the file is a replay log (CageReplay.h), recorded
+						by the game with REPLAY 1 or by -record: the level,
+						settings, frame times and restarts are the logged
+						ones, and the frames are replayed back to back
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "CageReplay.h"
+#include "CageSimulation.h"
+#include "LevelBinary.h"
+#include "LevelData.h"
+#include "Profiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	const int			FRAME_NUM_DEFAULT	= 1000;
+	const float			DT_DEFAULT			= 1.0f / 60.0f;
+
+	typedef std::chrono::steady_clock	Clock;
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// FNV-1a over the bits of the values, so any change in the results shows
+	unsigned long long HashFloats(unsigned long long hash, const float *pValues, unsigned int num)
+	{
+		for (unsigned int i = 0; i < num; ++i) {
+			unsigned int bits;
+			memcpy(&bits, pValues + i, sizeof(bits));
+			for (int b = 0; b < 4; ++b) {
+				hash ^= (bits >> (b * 8)) & 0xFFu;
+				hash *= 1099511628211ull;
+			}
+		}
+		return hash;
+	}
+
+	void PrintUsage()
+	{
+		printf("usage: CageHeadless <level file> [-frames N] [-dt seconds]\n"
+			"                    [-broadphase 0|1] [-collision 0|1|2] [-edges 0|1]\n"
+			"                    [-balls 0|1] [-threads N] [-dump] [-trace file.json]\n"
+			"                    [-record log.bin]\n"
+			"       CageHeadless <replay log> -replay [-threads N] [-dump] [-trace file.json]\n");
+	}
+}
+
+/******************************************************************************/
+/*!
+	Loads the level, steps it and prints a short report
+*/
+/******************************************************************************/
+int main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		PrintUsage();
+		return 1;
+	}
+
+	const char *pFileName = argv[1];
+	int frameNum = FRAME_NUM_DEFAULT;
+	float dt = DT_DEFAULT;
+	int broadphase = 1;
+	int collision = 0;
+	bool checkLineEdges = true;
+	bool ballCollision = false;
+	int threadNum = 1;
+	bool dump = false;
+	const char *pTraceName = NULL;
+	const char *pRecordName = NULL;
+	bool replaying = false;
+
+	for (int i = 2; i < argc; ++i) {
+		if (strcmp(argv[i], "-frames") == 0 && i + 1 < argc)
+			frameNum = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-dt") == 0 && i + 1 < argc)
+			dt = (float)atof(argv[++i]);
+		else if (strcmp(argv[i], "-broadphase") == 0 && i + 1 < argc)
+			broadphase = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-collision") == 0 && i + 1 < argc)
+			collision = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-edges") == 0 && i + 1 < argc)
+			checkLineEdges = atoi(argv[++i]) != 0;
+		else if (strcmp(argv[i], "-balls") == 0 && i + 1 < argc)
+			ballCollision = atoi(argv[++i]) != 0;
+		else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc)
+			threadNum = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-trace") == 0 && i + 1 < argc)
+			pTraceName = argv[++i];
+		else if (strcmp(argv[i], "-record") == 0 && i + 1 < argc)
+			pRecordName = argv[++i];
+		else if (strcmp(argv[i], "-replay") == 0)
+			replaying = true;
+		else if (strcmp(argv[i], "-dump") == 0)
+			dump = true;
+		else {
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	Clock::time_point start = Clock::now();
+
+	// a replay brings its level and settings, one step per frame otherwise
+	CageReplay replay;
+	unsigned int stepMax = 1;
+	LevelBinary level;
+
+	if (replaying) {
+		if (!CageReplayRead(replay, pFileName) || !CageReplayLevel(replay, level)) {
+			printf("Failed to read the replay log %s\n", pFileName);
+			return 1;
+		}
+
+		const CageReplaySettings &settings = replay.m_settings;
+		broadphase		= settings.m_broadphase;
+		collision		= settings.m_collision;
+		checkLineEdges	= settings.m_checkLineEdges != 0;
+		ballCollision	= settings.m_ballCollision != 0;
+		dt				= settings.m_stepDt;
+		stepMax			= settings.m_stepMax > 0 ? (unsigned int)settings.m_stepMax : 1;
+		frameNum		= (int)replay.m_frameDt.size();
+		pRecordName		= NULL;
+	}
+
+	if (broadphase > 1 || broadphase < 0)
+		broadphase = 0;
+	if (collision > 2 || collision < 0)
+		collision = 0;
+	if (threadNum < 0)
+		threadNum = 0;
+
+	// a compiled level is mapped, anything else is read as a text level
+	if (!replaying && !LevelBinaryOpen(level, pFileName)) {
+		LevelData levelData;
+		if (!LevelDataLoad(levelData, pFileName) || !LevelBinaryBuild(level, levelData)) {
+			printf("Failed to open the level file %s\n", pFileName);
+			return 1;
+		}
+	}
+
+	CageSimulation sim;
+	CageSimInit(sim, level, broadphase, collision, checkLineEdges, ballCollision);
+	double loadMs = ElapsedMs(start);
+
+	if (pRecordName) {
+		CageReplaySettings settings;
+		settings.m_broadphase		= broadphase;
+		settings.m_collision		= collision;
+		settings.m_checkLineEdges	= checkLineEdges ? 1 : 0;
+		settings.m_ballCollision	= ballCollision ? 1 : 0;
+		settings.m_stepDt			= dt;
+		settings.m_stepMax			= (int)stepMax;
+		CageReplayBegin(replay, settings, level);
+	}
+
+	JobSystem jobs;
+	JobSystemInit(jobs, (unsigned int)threadNum);
+
+	ProfilerInit(pTraceName != NULL);
+
+	start = Clock::now();
+	unsigned long long stepNum = 0;
+	for (int frame = 0; frame < frameNum; ++frame) {
+		ProfilerFrameBegin();
+
+		float frameDt = dt;
+		unsigned char keys = 0;
+		if (replaying)
+			CageReplayNext(replay, frameDt, keys);
+		else if (pRecordName)
+			CageReplayRecord(replay, frameDt, keys);
+
+		// the same fixed steps as the game, or one step of dt
+		if (replaying)
+			stepNum += CageSimAdvance(sim, frameDt, dt, stepMax, &jobs);
+		else {
+			CageSimStep(sim, dt, &jobs);
+			++stepNum;
+		}
+
+		// the game restarts after the frame, from the same level
+		if (keys & CAGE_REPLAY_KEY_RESTART)
+			CageSimRestart(sim, level);
+	}
+	double stepMs = ElapsedMs(start);
+
+	if (pRecordName && !CageReplayWrite(replay, pRecordName))
+		printf("Failed to write %s\n", pRecordName);
+
+	if (pTraceName && !ProfilerWriteChromeTrace(pTraceName))
+		printf("Failed to write %s\n", pTraceName);
+	ProfilerShutdown();
+
+	const BallStore &balls = sim.m_balls;
+	unsigned long long hash = 14695981039346656037ull;
+	hash = HashFloats(hash, balls.m_posX.data(), balls.m_count);
+	hash = HashFloats(hash, balls.m_posY.data(), balls.m_count);
+	hash = HashFloats(hash, balls.m_velX.data(), balls.m_count);
+	hash = HashFloats(hash, balls.m_velY.data(), balls.m_count);
+
+	if (dump) {
+		for (unsigned int i = 0; i < balls.m_count; ++i)
+			printf("%u %.9g %.9g %.9g %.9g\n", i, balls.m_posX[i], balls.m_posY[i], balls.m_velX[i], balls.m_velY[i]);
+	}
+
+	printf("level       %s\n", pFileName);
+	printf("balls       %u\n", balls.m_count);
+	printf("walls       %u\n", sim.m_wallNum);
+	printf("pillars     %u\n", sim.m_pillarNum);
+	printf("broadphase  %s\n", broadphase == 0 ? "grid" : "bvh");
+	const char *collisionNames[] = { "in order", "continuous", "event driven" };
+	printf("collision   %s\n", collisionNames[collision]);
+	printf("edges       %d\n", checkLineEdges ? 1 : 0);
+	printf("ball-ball   %d\n", sim.m_ballCollision ? 1 : 0);
+	printf("threads     %u\n", JobSystemWorkerNum(jobs));
+	printf("frames      %d  steps %llu  dt %g%s\n", frameNum, stepNum, dt, replaying ? "  (replay)" : "");
+	printf("load        %.3f ms\n", loadMs);
+	printf("step        %.3f ms  (%.4f ms/frame)\n", stepMs, frameNum > 0 ? stepMs / frameNum : 0.0);
+	printf("wall tests  %llu  (%.1f per frame)\n", CageSimWallTestNum(sim),
+		frameNum > 0 ? (double)CageSimWallTestNum(sim) / frameNum : 0.0);
+	printf("ball tests  %llu  (%.1f per frame)\n", CageSimBallTestNum(sim),
+		frameNum > 0 ? (double)CageSimBallTestNum(sim) / frameNum : 0.0);
+	printf("checksum    %016llx\n", hash);
+
+	CageSimClear(sim);
+	LevelBinaryClose(level);
+	JobSystemShutdown(jobs);
+	return 0;
+}
@@ -0,0 +1,75 @@
+/******************************************************************************/
+/*!
+\file		LevelCompiler.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Compiles "LevelData - *.txt" level files into the binary format
+			of LevelBinary.h, which GameStateCageInit maps in place of the
+			text file when it finds one next to it, compiled from the text
+			file as it is now.
+
+			Usage:
+			LevelCompiler <level.txt> [output.bin]
+
+			The output defaults to the input path with its extension
+			replaced by ".bin".
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelBinary.h"
+#include "LevelData.h"
+
+#include <cstdio>
+#include <string>
+
+/******************************************************************************/
+/*!
+	Compiles the level given on the command line
+*/
+/******************************************************************************/
+int main(int argc, char *argv[])
+{
+	if (argc < 2 || argc > 3) {
+		printf("usage: LevelCompiler <level.txt> [output.bin]\n");
+		return 1;
+	}
+
+	std::string inName = argv[1], outName;
+	if (argc == 3)
+		outName = argv[2];
+	else {
+		size_t dot = inName.find_last_of('.');
+		size_t slash = inName.find_last_of("/\\");
+		if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+			dot = inName.size();
+		outName = inName.substr(0, dot) + ".bin";
+	}
+
+	LevelData levelData;
+	if (!LevelDataLoad(levelData, inName.c_str())) {
+		printf("Failed to open the text file %s\n", inName.c_str());
+		return 1;
+	}
+
+	LevelBinary level;
+	if (!LevelBinaryBuild(level, levelData)) {
+		printf("Level %s is too large to compile\n", inName.c_str());
+		return 1;
+	}
+
+	if (!LevelBinaryWrite(level, outName.c_str())) {
+		printf("Failed to write %s\n", outName.c_str());
+		return 1;
+	}
+
+	printf("%s: %u balls, %u walls, %u pillars, %u bytes -> %s\n", inName.c_str(),
+		level.m_ballNum, level.m_wallNum, level.m_pillarNum, level.m_pHeader->m_size, outName.c_str());
+
+	LevelBinaryClose(level);
+	return 0;
+}
@@ -0,0 +1,160 @@
+/******************************************************************************/
+/*!
+\file		LevelGenerator.cpp
+\author 	Guo Yiming, yiming.guo, 2202613
+\par    	email: yiming.guo@digipen.edu
+\date   	Oct 17, 2026
+\brief		Generates stress levels for the Cage state: square cages nested
+			in each other, loose walls inside them and balls spread over
+			the whole area without touching a wall or another ball, written
+			as a "LevelData - *.txt" text file or compiled like
+			LevelCompiler does.
+
+			The level comes from LevelRandomGenerate (LevelRandom.h): the
+			same seed and options give the same level on every platform,
+			and a compiled level is the one compiling the text file would
+			give.
+
+			Usage:
+			LevelGenerator <output.txt|output.bin> [-seed N] [-balls N]
+						   [-size half size] [-cages N] [-sides N]
+						   [-walls N] [-length min max] [-loglength]
+						   [-speed min max] [-radius min max]
+
+			-seed		seed of the generator (default 1130)
+			-balls		number of balls (default 1000)
+			-size		half size of the outer cage (default 400 for 500
+						balls, scaled to keep the same density)
+			-cages		number of nested cages, evenly spaced (default 1)
+			-sides		walls each side of a cage is split into (default 1)
+			-walls		number of loose walls inside the outer cage
+						(default 0)
+			-length		length range of the loose walls (default 10 80)
+			-loglength	draw the lengths log-uniformly, many short walls
+						and few long ones (default uniform)
+			-speed		ball speed range (default 50 400)
+			-radius		ball radius range (default 2 10)
+
+			e.g. the 1k/10k/100k/1M workloads:
+			LevelGenerator "LevelData - 1M.bin" -balls 1000000 -cages 4 -walls 10000
+
+Copyright (C) 2023 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+/******************************************************************************/
+
+#include "LevelBinary.h"
+#include "LevelData.h"
+#include "LevelRandom.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+	void PrintUsage()
+	{
+		printf("usage: LevelGenerator <output.txt|output.bin> [-seed N] [-balls N]\n"
+			"                      [-size half size] [-cages N] [-sides N]\n"
+			"                      [-walls N] [-length min max] [-loglength]\n"
+			"                      [-speed min max] [-radius min max]\n");
+	}
+}
+
+/******************************************************************************/
+/*!
+	Generates the level described on the command line
+*/
+/******************************************************************************/
+int main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		PrintUsage();
+		return 1;
+	}
+
+	std::string outName = argv[1];
+	LevelRandomSettings settings;
+
+	for (int i = 2; i < argc; ++i) {
+		if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc)
+			settings.m_seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-balls") == 0 && i + 1 < argc)
+			settings.m_ballNum = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-size") == 0 && i + 1 < argc)
+			settings.m_size = (float)atof(argv[++i]);
+		else if (strcmp(argv[i], "-cages") == 0 && i + 1 < argc)
+			settings.m_cageNum = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-sides") == 0 && i + 1 < argc)
+			settings.m_sideNum = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-walls") == 0 && i + 1 < argc)
+			settings.m_wallNum = (unsigned int)strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-length") == 0 && i + 2 < argc) {
+			settings.m_lengthMin = (float)atof(argv[++i]);
+			settings.m_lengthMax = (float)atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-loglength") == 0)
+			settings.m_logLength = true;
+		else if (strcmp(argv[i], "-speed") == 0 && i + 2 < argc) {
+			settings.m_speedMin = (float)atof(argv[++i]);
+			settings.m_speedMax = (float)atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-radius") == 0 && i + 2 < argc) {
+			settings.m_radiusMin = (float)atof(argv[++i]);
+			settings.m_radiusMax = (float)atof(argv[++i]);
+		}
+		else {
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (settings.m_size <= 0.0f)
+		settings.m_size = LevelRandomSizeDefault(settings.m_ballNum);
+	if (settings.m_cageNum < 1)
+		settings.m_cageNum = 1;
+	if (settings.m_sideNum < 1)
+		settings.m_sideNum = 1;
+	if (settings.m_lengthMin <= 0.0f || settings.m_lengthMax < settings.m_lengthMin ||
+		settings.m_speedMax < settings.m_speedMin ||
+		settings.m_radiusMin <= 0.0f || settings.m_radiusMax < settings.m_radiusMin) {
+		printf("Invalid range\n");
+		return 1;
+	}
+
+	LevelData levelData;
+	if (!LevelRandomGenerate(levelData, settings)) {
+		printf("Could not fit %u balls and %u walls in a cage of half size %g\n",
+			settings.m_ballNum, settings.m_wallNum, (double)settings.m_size);
+		return 1;
+	}
+
+	// compiled when the output is a .bin file, as text otherwise
+	size_t dot = outName.find_last_of('.');
+	bool compiled = dot != std::string::npos && outName.compare(dot, std::string::npos, ".bin") == 0;
+
+	if (compiled) {
+		LevelBinary level;
+		if (!LevelBinaryBuild(level, levelData)) {
+			printf("Level is too large to compile\n");
+			return 1;
+		}
+		if (!LevelBinaryWrite(level, outName.c_str())) {
+			printf("Failed to write %s\n", outName.c_str());
+			return 1;
+		}
+		LevelBinaryClose(level);
+	}
+	else if (!LevelDataWrite(levelData, outName.c_str())) {
+		printf("Failed to write %s\n", outName.c_str());
+		return 1;
+	}
+
+	printf("%s: seed %u, %u balls, %u walls (%u in %u cages, %u loose), half size %g\n", outName.c_str(),
+		settings.m_seed, (unsigned int)levelData.m_balls.size(), (unsigned int)levelData.m_walls.size(),
+		(unsigned int)levelData.m_walls.size() - settings.m_wallNum, settings.m_cageNum, settings.m_wallNum, (double)settings.m_size);
+	return 0;
+}